@@ -0,0 +1,271 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "Smoothing_Spline_1D.h"
+#include "Smoothing_Spline.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace Com_Methods;
+
+// Счётчики выделений памяти: глобальные operator new / delete подменяются только в этой программе.
+// Подменяются все формы (одиночные и массивы, обычные и nothrow, с размером и без), чтобы каждое
+// выделение учитывалось и освобождалось парной функцией
+static std::atomic<long long> allocation_count(0);
+static std::atomic<long long> allocation_bytes(0);
+
+// GCC, встроив подменённый operator delete в код контейнеров, видит пару operator new / free
+// и выдаёт ложное предупреждение -Wmismatched-new-delete; встраивание запрещается
+#if defined(__GNUC__)
+#define NOINLINE_DELETE __attribute__((noinline))
+#else
+#define NOINLINE_DELETE
+#endif
+
+static void* counted_allocate(std::size_t size) noexcept {
+    allocation_count++;
+    allocation_bytes += size;
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new(std::size_t size) {
+    if (void* ptr = counted_allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* ptr = counted_allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_allocate(size);
+}
+
+NOINLINE_DELETE void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+NOINLINE_DELETE void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+NOINLINE_DELETE void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+NOINLINE_DELETE void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+NOINLINE_DELETE void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+NOINLINE_DELETE void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+// Сброс пикового объёма памяти процесса (Linux: /proc/self/clear_refs); иначе пик считается от запуска
+void reset_peak_memory() {
+#ifdef __linux__
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs.is_open()) clear_refs << "5";
+#endif
+}
+
+// Пиковый объём резидентной памяти процесса в КБ
+long long peak_memory_kb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+    return -1;
+#else
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) return std::atoll(line.c_str() + 6);
+    }
+#endif
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+struct Benchmark_Result {
+    std::string name;
+    std::size_t n;
+    std::vector<double> seconds;   // время каждого замера
+    double allocations_per_run;
+    double allocated_bytes_per_run;
+    long long peak_memory_kb;
+    double max_error = -1.0;       // отклонение от double-результата (-1, если не измерялось)
+};
+
+// Замер функции run: warmup прогонов без учёта, затем repeats замеров; prepare выполняется
+// перед каждым прогоном вне замера (например, создание нового объекта сплайна)
+template <class Prepare, class Run>
+Benchmark_Result measure(const std::string& name, std::size_t n, int warmup, int repeats,
+    Prepare prepare, Run run) {
+    Benchmark_Result result;
+    result.name = name;
+    result.n = n;
+
+    reset_peak_memory();
+    for (int i = 0; i < warmup; ++i) {
+        prepare();
+        run();
+    }
+
+    long long count = 0, bytes = 0;
+    for (int i = 0; i < repeats; ++i) {
+        prepare();
+        long long count_start = allocation_count, bytes_start = allocation_bytes;
+        auto start = std::chrono::steady_clock::now();
+        run();
+        auto finish = std::chrono::steady_clock::now();
+        count += allocation_count - count_start;
+        bytes += allocation_bytes - bytes_start;
+        result.seconds.push_back(std::chrono::duration<double>(finish - start).count());
+    }
+    result.allocations_per_run = static_cast<double>(count) / repeats;
+    result.allocated_bytes_per_run = static_cast<double>(bytes) / repeats;
+    result.peak_memory_kb = peak_memory_kb();
+    return result;
+}
+
+void write_json(std::ostream& out, const std::vector<Benchmark_Result>& results, int warmup, int repeats) {
+    out << "{\n  \"benchmark\": \"Smoothing_Spline_1D\",\n";
+#if defined(__OPTIMIZE__) || defined(NDEBUG)
+    out << "  \"optimized\": true,\n";
+#else
+    out << "  \"optimized\": false,\n";
+#endif
+    out << "  \"warmup\": " << warmup << ",\n  \"repeats\": " << repeats << ",\n  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Benchmark_Result& r = results[i];
+        std::vector<double> sorted = r.seconds;
+        std::sort(sorted.begin(), sorted.end());
+        double median = sorted[sorted.size() / 2];
+        double mean = 0.0;
+        for (double s : sorted) mean += s;
+        mean /= sorted.size();
+
+        out << "    {\"name\": \"" << r.name << "\", \"n\": " << r.n
+            << ", \"min_s\": " << sorted.front() << ", \"median_s\": " << median
+            << ", \"mean_s\": " << mean << ", \"max_s\": " << sorted.back()
+            << ", \"points_per_s\": " << (median > 0.0 ? r.n / median : 0.0)
+            << ", \"allocations\": " << r.allocations_per_run
+            << ", \"allocated_bytes\": " << r.allocated_bytes_per_run
+            << ", \"peak_memory_kb\": " << r.peak_memory_kb;
+        if (r.max_error >= 0.0) out << ", \"max_error\": " << r.max_error;
+        out << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+// Использование: SplineBenchmark [max_n = 1e7] [repeats = 5] [output.json]
+// Размеры задачи - степени 10 от 1e3 до max_n (до 1e8 нужно порядка 10 ГБ памяти).
+// Результаты в формате JSON выводятся в файл или в стандартный поток вывода.
+int main(int argc, char* argv[]) {
+    std::size_t max_n = argc > 1 ? static_cast<std::size_t>(std::atof(argv[1])) : 10000000;
+    int repeats = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+    int warmup = 1;
+    const double p = 0.5;
+
+    std::vector<Benchmark_Result> results;
+    for (std::size_t n = 1000; n <= max_n; n *= 10) {
+        std::cerr << "n = " << n << "..." << std::endl;
+
+        // неравномерная сетка и зашумлённые значения
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        std::vector<double> xs(n), values(n), queries(n), out(n), der(n);
+        std::vector<Point> points;
+        points.reserve(n);
+        double x = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            xs[i] = x;
+            values[i] = std::sin(x * 0.01) + dist(gen);
+            points.emplace_back(x, 0, 0);
+            x += 0.5 + dist(gen);
+        }
+        for (std::size_t i = 0; i < n; ++i) queries[i] = xs.back() * (i + 0.5) / n;
+
+        Smoothing_Spline_1D spline(p);
+        auto fresh = [&]() { spline = Smoothing_Spline_1D(p); };
+        auto nothing = []() {};
+
+        results.push_back(measure("update_spline_points", n, warmup, repeats, fresh,
+            [&]() { spline.Update_Spline(points, values); }));
+        results.push_back(measure("update_spline_arrays", n, warmup, repeats, fresh,
+            [&]() { spline.Update_Spline(xs.data(), values.data(), n); }));
+        results.push_back(measure("update_values", n, warmup, repeats, nothing,
+            [&]() { spline.Update_Values(values.data(), n); }));
+        results.push_back(measure("get_value", n, warmup, repeats, nothing,
+            [&]() {
+                double res[3];
+                for (std::size_t i = 0; i < n; ++i) {
+                    spline.Get_Value(Point(queries[i], 0, 0), res);
+                    out[i] = res[0];
+                }
+            }));
+        results.push_back(measure("get_values", n, warmup, repeats, nothing,
+            [&]() { spline.Get_Values(queries.data(), n, out.data(), der.data()); }));
+
+        // тот же линейный сплайн в шаблонной реализации: хранение в double и во float
+        Linear_Smoothing_Spline template_spline(p);
+        Linear_Smoothing_Spline_Float float_spline(p);
+        template_spline.Update_Spline(points, values);
+        float_spline.Update_Spline(points, values);
+        std::vector<float> queries_float(queries.begin(), queries.end()), out_float(n), der_float(n);
+
+        results.push_back(measure("get_values_template_double", n, warmup, repeats, nothing,
+            [&]() { template_spline.Get_Values(queries.data(), n, out.data(), der.data()); }));
+        results.push_back(measure("get_values_float", n, warmup, repeats, nothing,
+            [&]() { float_spline.Get_Values(queries_float.data(), n, out_float.data(), der_float.data()); }));
+
+        double max_error = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+            max_error = std::max(max_error, std::abs(static_cast<double>(out_float[i]) - out[i]));
+        results.back().max_error = max_error;
+    }
+
+    if (argc > 3) {
+        std::ofstream file(argv[3]);
+        if (!file.is_open()) {
+            std::cerr << "ERROR: Cannot open " << argv[3] << std::endl;
+            return 1;
+        }
+        write_json(file, results, warmup, repeats);
+    }
+    else {
+        write_json(std::cout, results, warmup, repeats);
+    }
+    return 0;
+}
\ No newline at end of file
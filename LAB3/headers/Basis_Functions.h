@@ -0,0 +1,54 @@
+#pragma once
+#ifndef BASIS_FUNCTIONS_H
+#define BASIS_FUNCTIONS_H
+
+namespace Com_Methods {
+    // Базисные функции порядка Order на элементе [x_i, x_{i+1}] длины h в локальной координате
+    // t = (Ksi + 1) / 2 из [0, 1]; Phi<Number, Derivative> - производная порядка Derivative по x.
+    // Номер функции и порядок производной - параметры шаблона, поэтому вычисление сводится
+    // к полиному без ветвлений во время выполнения. Вычисления ведутся в типе аргументов T
+    // (float или double).
+    template <int Order> struct Basis_Functions;
+
+    // линейный лагранжев базис: степень свободы - значение в узле
+    template <> struct Basis_Functions<1> {
+        static constexpr int Nodal_Dofs = 1;           // степеней свободы в узле
+        static constexpr int Element_Dofs = 2;         // степеней свободы на элементе
+        static constexpr int Smoothing_Derivative = 1; // сглаживание по первой производной
+
+        template <int Number, int Derivative, class T>
+        static constexpr T Phi(T t, T h) {
+            return Derivative == 0 ? (Number == 0 ? T(1) - t : t) :
+                   Derivative == 1 ? (Number == 0 ? T(-1) / h : T(1) / h) : T(0);
+        }
+    };
+
+    // кубический эрмитов базис: степени свободы - значение и первая производная в узле,
+    // функции с номерами 0, 1 относятся к узлу x_i, 2, 3 - к узлу x_{i+1}
+    template <> struct Basis_Functions<3> {
+        static constexpr int Nodal_Dofs = 2;
+        static constexpr int Element_Dofs = 4;
+        static constexpr int Smoothing_Derivative = 2; // сглаживание по второй производной
+
+        template <int Number, int Derivative, class T>
+        static constexpr T Phi(T t, T h) {
+            return Derivative == 0 ?
+                       (Number == 0 ? T(1) - T(3) * t * t + T(2) * t * t * t :
+                        Number == 1 ? h * (t - T(2) * t * t + t * t * t) :
+                        Number == 2 ? T(3) * t * t - T(2) * t * t * t :
+                                      h * (t * t * t - t * t)) :
+                   Derivative == 1 ?
+                       (Number == 0 ? T(6) * (t * t - t) / h :
+                        Number == 1 ? T(1) - T(4) * t + T(3) * t * t :
+                        Number == 2 ? T(6) * (t - t * t) / h :
+                                      T(3) * t * t - T(2) * t) :
+                   Derivative == 2 ?
+                       (Number == 0 ? (T(12) * t - T(6)) / (h * h) :
+                        Number == 1 ? (T(6) * t - T(4)) / h :
+                        Number == 2 ? (T(6) - T(12) * t) / (h * h) :
+                                      (T(6) * t - T(2)) / h) : T(0);
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef MAPPED_SMOOTHING_SPLINE_1D_H
+#define MAPPED_SMOOTHING_SPLINE_1D_H
+
+#include <string>
+#include "Spline.h"
+
+namespace Com_Methods {
+    // Сглаживающий сплайн, загруженный из файла формата Spline_File_Header отображением в память.
+    // Узлы и коэффициенты не копируются: вычисление идёт прямо по отображённым массивам,
+    // страницы файла разделяются между процессами и подгружаются по мере обращения.
+    // Сплайн доступен только для чтения (Update_Spline бросает исключение).
+    class Mapped_Smoothing_Spline_1D : public Spline {
+    private:
+        void *Data;               // начало отображения
+        std::size_t Data_Size;    // размер отображения
+        void *Mapping_Handle;     // объект отображения (только Windows)
+        const double *Knots;      // узлы сетки
+        const double *alpha;      // коэффициенты разложения
+        std::size_t Count;        // число узлов
+        double SMOOTH;            // параметр сглаживания
+
+        void Unmap();
+        int Find_Segment(double X, int Guess = -1) const;
+
+    public:
+        explicit Mapped_Smoothing_Spline_1D(const std::string &File_Name);
+        ~Mapped_Smoothing_Spline_1D();
+        Mapped_Smoothing_Spline_1D(const Mapped_Smoothing_Spline_1D &) = delete;
+        Mapped_Smoothing_Spline_1D &operator=(const Mapped_Smoothing_Spline_1D &) = delete;
+
+        void Update_Spline(const std::vector<Point> &Points,
+                           const std::vector<double> &F_Value) override;
+        void Get_Value(const Point &P, double *Res) const override;
+        // пакетное вычисление (для упорядоченных X сегменты находятся одним проходом)
+        void Get_Values(const double *X, std::size_t Count, double *Values, double *Derivatives = nullptr) const;
+
+        std::size_t Size() const { return Count; }
+        double Get_Smoothing_Parameter() const { return SMOOTH; }
+    };
+}
+
+#endif
\ No newline at end of file
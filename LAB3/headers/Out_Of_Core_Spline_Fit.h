@@ -0,0 +1,38 @@
+#pragma once
+#ifndef OUT_OF_CORE_SPLINE_FIT_H
+#define OUT_OF_CORE_SPLINE_FIT_H
+
+#include <string>
+#include <cstddef>
+
+namespace Com_Methods {
+    // Построение сглаживающего сплайна Smoothing_Spline_1D по данным, не помещающимся в память.
+    // Входной файл - пары (x, f) типа double подряд, x строго возрастают (узлы сетки совпадают
+    // с точками данных, как в Smoothing_Spline_1D::Update_Spline).
+    // Первый проход читает данные блоками по Chunk_Size точек и выполняет прямой ход прогонки:
+    // ведущие элементы, наддиагональ и правая часть строк сбрасываются блоками во временный файл,
+    // узлы - сразу в результирующий файл. Второй проход читает временный файл блоками с конца,
+    // выполняет обратный ход и записывает коэффициенты alpha на их место в результирующем файле.
+    // Результат - файл формата Spline_File_Header (Mapped_Smoothing_Spline_1D, Smoothing_Spline_1D::Load).
+    // Память: 6 * Chunk_Size значений double независимо от числа точек.
+    class Out_Of_Core_Spline_Fit {
+    private:
+        double SMOOTH;          // параметр сглаживания p
+        std::size_t Chunk_Size; // число точек в блоке
+        std::string Work_File;  // временный файл прямого хода (пусто - <результат>.tmp)
+
+    public:
+        Out_Of_Core_Spline_Fit(const double &SMOOTH = 0.5, std::size_t Chunk_Size = 1 << 20);
+
+        // построение сплайна по файлу Data_File с записью в Spline_File; возвращает число узлов.
+        // Spline_File заменяется только при успешном построении (запись идёт в Spline_File + ".part")
+        std::size_t Fit(const std::string &Data_File, const std::string &Spline_File) const;
+
+        void Set_Chunk_Size(std::size_t Chunk_Size);
+        void Set_Work_File(const std::string &Work_File) { this->Work_File = Work_File; }
+        void Set_Smoothing_Parameter(double p) { SMOOTH = p; }
+        double Get_Smoothing_Parameter() const { return SMOOTH; }
+    };
+}
+
+#endif
\ No newline at end of file
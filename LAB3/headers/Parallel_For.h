@@ -0,0 +1,32 @@
+#pragma once
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <thread>
+#include <vector>
+
+namespace Com_Methods {
+    // разбиение диапазона [Begin, End) на Num_Threads непрерывных частей и вызов
+    // Body(From, To) для каждой части в отдельном потоке (первая часть - в вызывающем)
+    template <class Function>
+    void Parallel_For(int Num_Threads, long long Begin, long long End, const Function &Body) {
+        long long Count = End - Begin;
+        if (Num_Threads > Count) Num_Threads = static_cast<int>(Count);
+        if (Num_Threads <= 1) {
+            if (Count > 0) Body(Begin, End);
+            return;
+        }
+
+        std::vector<std::thread> Threads;
+        Threads.reserve(Num_Threads - 1);
+        for (int t = 1; t < Num_Threads; t++) {
+            long long From = Begin + Count * t / Num_Threads;
+            long long To = Begin + Count * (t + 1) / Num_Threads;
+            Threads.emplace_back([&Body, From, To]() { Body(From, To); });
+        }
+        Body(Begin, Begin + Count / Num_Threads);
+        for (auto &Thread : Threads) Thread.join();
+    }
+}
+
+#endif
\ No newline at end of file
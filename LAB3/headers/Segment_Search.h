@@ -0,0 +1,50 @@
+#pragma once
+#ifndef SEGMENT_SEARCH_H
+#define SEGMENT_SEARCH_H
+
+#include <cmath>
+#include <algorithm>
+
+namespace Com_Methods {
+    // Номер сегмента [Knots[i], Knots[i + 1]] возрастающей сетки [First, Last), содержащего X, или -1.
+    // Точка вне сетки ближе eps к крайнему узлу относится к крайнему сегменту; точка в узле
+    // (с точностью eps) - к левому из сегментов, содержащих этот узел. NaN не найден никогда.
+    // Guess - сегмент предыдущего запроса (-1, если его нет): от него сетка проходится шагами
+    // 1, 2, 4, ... и затем двоичным поиском, так что запрос вдали от Guess стоит O(log N).
+    // Grid_Step > 0 - шаг равномерной сетки: без Guess сегмент находится по индексу за O(1).
+    template <class Iterator, class T>
+    int Locate_Segment(Iterator First, Iterator Last, T X, int Guess = -1, T Grid_Step = T(0)) {
+        T eps = T(1e-7);
+        int Num_Segments = static_cast<int>(Last - First) - 1;
+        if (Num_Segments < 1 || std::isnan(X)) return -1;
+
+        //номер последнего узла, не превосходящего X
+        int i;
+        if (Guess >= 0 && Guess < Num_Segments && First[Guess] <= X) {
+            int Low = Guess, Step = 1;
+            while (Low + Step <= Num_Segments && First[Low + Step] <= X) {
+                Low += Step;
+                Step *= 2;
+            }
+            int High = std::min(Low + Step, Num_Segments + 1);
+            i = static_cast<int>(std::upper_bound(First + Low, First + High, X) - First) - 1;
+        }
+        else if (Grid_Step > T(0)) {
+            T Pos = (X - First[0]) / Grid_Step;
+            i = Pos < T(0) ? -1 : (Pos >= Num_Segments ? Num_Segments : static_cast<int>(Pos));
+            //поправка на ошибки округления
+            if (i >= 0 && First[i] > X) i--;
+            if (i < Num_Segments && First[i + 1] <= X) i++;
+        }
+        else {
+            i = static_cast<int>(std::upper_bound(First, Last, X) - First) - 1;
+        }
+
+        if (i < 0) return std::fabs(X - First[0]) < eps ? 0 : -1;
+        if (i == Num_Segments && std::fabs(X - First[Num_Segments]) >= eps) return -1;
+        while (i > 0 && std::fabs(X - First[i]) < eps) i--;
+        return std::min(i, Num_Segments - 1);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef SMOOTHING_PARAMETER_SELECTOR_H
+#define SMOOTHING_PARAMETER_SELECTOR_H
+
+#include <vector>
+#include "Point.h"
+
+namespace Com_Methods {
+    // критерий выбора параметра сглаживания
+    enum class Selection_Criterion {
+        GCV,             // обобщённая кросс-валидация
+        Cross_Validation // k-кратная кросс-валидация
+    };
+
+    struct Smoothing_Parameter_Score {
+        double SMOOTH;            // параметр сглаживания p
+        double Score;             // значение критерия (+inf, если система вырождена)
+        double Average_Deviation; // среднее отклонение сплайна от данных в узлах
+        double Max_Deviation;     // максимальное отклонение сплайна от данных в узлах
+    };
+
+    // Перебор параметра сглаживания для сплайна Smoothing_Spline_1D (линейный базис, данные в узлах).
+    // Матрица СЛАУ равна (1 - p) * D + p * K, где D - диагональная часть от данных, K - от сглаживания
+    // по первой производной; D и K собираются один раз, для каждого p выполняется только прогонка.
+    // Значения p распределяются по потокам.
+    class Smoothing_Parameter_Selector {
+    private:
+        std::vector<double> F;            // значения в узлах
+        std::vector<double> Data_Weight;  // диагональ D
+        std::vector<double> Stiff_b, Stiff_c; // диагональ и наддиагональ K
+        int Num_Threads;
+        int Num_Folds;
+
+        // решение для параметра p с выброшенной группой точек Fold (-1 - все точки);
+        // Pivot - ведущие элементы прогонки; false, если матрица вырождена
+        bool Fit(double p, int Fold, std::vector<double> &Alpha, std::vector<double> &Pivot) const;
+        double Weight(int i, int Fold) const;
+
+    public:
+        Smoothing_Parameter_Selector(const std::vector<Point> &Points, const std::vector<double> &F_Value);
+
+        void Set_Num_Threads(int Num_Threads) { this->Num_Threads = Num_Threads < 1 ? 1 : Num_Threads; }
+        // число групп k-кратной кросс-валидации: узел i относится к группе i % Num_Folds
+        void Set_Num_Folds(int Num_Folds) { this->Num_Folds = Num_Folds; }
+
+        // значения критерия для всех p из P_Values (в том же порядке)
+        std::vector<Smoothing_Parameter_Score> Sweep(const std::vector<double> &P_Values,
+                                                     Selection_Criterion Criterion) const;
+        // параметр с наименьшим значением критерия
+        Smoothing_Parameter_Score Find_Optimal(const std::vector<double> &P_Values,
+                                               Selection_Criterion Criterion) const;
+    };
+}
+
+#endif
\ No newline at end of file
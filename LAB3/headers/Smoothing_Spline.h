@@ -0,0 +1,233 @@
+#pragma once
+#ifndef SMOOTHING_SPLINE_H
+#define SMOOTHING_SPLINE_H
+
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include "Spline.h"
+#include "Basis_Functions.h"
+#include "Segment_Search.h"
+
+namespace Com_Methods {
+    // Сглаживающий сплайн с базисом порядка Order (Basis_Functions<Order>):
+    // минимизируется (1 - p) * sum w (u(x_k) - f_k)^2 + p * int (u^(s))^2 dx,
+    // s = Basis_Functions<Order>::Smoothing_Derivative. Точка данных входит в каждый содержащий её
+    // сегмент (точка в общем узле - в оба), как в Smoothing_Spline_1D, поэтому при Order = 1 и
+    // данных в узлах получается та же СЛАУ. Ленточная СЛАУ решается методом Холецкого.
+    // При Order = 3 сетка может быть значительно реже точек данных; SMOOTH должен быть > 0,
+    // если данные не определяют все степени свободы.
+    // Scalar - тип хранения узлов и коэффициентов (double или float). Сборка и решение СЛАУ всегда
+    // выполняются в double, результат округляется до Scalar; пакетное Get_Values считает в Scalar.
+    // Для Scalar = float ошибка значения относительно double-сплайна не превосходит примерно
+    //   2^-24 * (3 * max|alpha| + 2 * |x| * |u'(x)|)
+    // (округление коэффициентов, узлов и арифметика float), для производной - та же величина, делённая на h.
+    template <int Order, class Scalar = double>
+    class Smoothing_Spline : public Spline {
+    private:
+        typedef Basis_Functions<Order> Basis;
+        static constexpr int Nodal_Dofs = Basis::Nodal_Dofs;
+        static constexpr int Element_Dofs = Basis::Element_Dofs;
+        static constexpr int Band_Width = 2 * Basis::Nodal_Dofs - 1; // полуширина ленты
+
+        double SMOOTH;               // параметр сглаживания p
+        std::vector<Scalar> Knots;   // узлы сетки
+        std::vector<Scalar> alpha;   // коэффициенты разложения (Nodal_Dofs на узел)
+
+        // значения базисных функций (или их производных порядка Derivative) в точке t
+        template <int Derivative, class T, std::size_t... Number>
+        static void Basis_Values(T t, T h, T *Phi, std::index_sequence<Number...>) {
+            using Swallow = int[];
+            (void)Swallow{ (Phi[Number] = Basis::template Phi<static_cast<int>(Number), Derivative>(t, h), 0)... };
+        }
+        template <int Derivative, class T>
+        static void Basis_Values(T t, T h, T *Phi) {
+            Basis_Values<Derivative>(t, h, Phi, std::make_index_sequence<Element_Dofs>());
+        }
+
+    public:
+        Smoothing_Spline(const double &SMOOTH = 0.5) : SMOOTH(SMOOTH) {}
+
+        // узлы сетки совпадают с точками данных
+        void Update_Spline(const std::vector<Point> &Points,
+                           const std::vector<double> &F_Value) override;
+        // сетка Knots и Count точек данных (X, F_Value) внутри неё
+        void Update_Spline(const std::vector<double> &Knots,
+                           const double *X, const double *F_Value, std::size_t Count);
+        // Res[0] - значение, Res[1] - первая производная, Res[2] = 0
+        void Get_Value(const Point &P, double *Res) const override;
+        // пакетное вычисление в типе Scalar (Derivatives может быть nullptr);
+        // для упорядоченных по возрастанию X сегменты находятся одним проходом по сетке
+        void Get_Values(const Scalar *X, std::size_t Count, Scalar *Values, Scalar *Derivatives = nullptr) const;
+
+        void Set_Smoothing_Parameter(double p) { SMOOTH = p; }
+        double Get_Smoothing_Parameter() const { return SMOOTH; }
+    };
+
+    typedef Smoothing_Spline<1> Linear_Smoothing_Spline;
+    typedef Smoothing_Spline<3> Cubic_Smoothing_Spline;
+    typedef Smoothing_Spline<1, float> Linear_Smoothing_Spline_Float;
+    typedef Smoothing_Spline<3, float> Cubic_Smoothing_Spline_Float;
+
+    template <int Order, class Scalar>
+    void Smoothing_Spline<Order, Scalar>::Update_Spline(const std::vector<Point> &Points,
+                                                const std::vector<double> &F_Value)
+    {
+        if (F_Value.size() != Points.size()) throw std::runtime_error("The number of values does not match the grid...");
+
+        std::vector<double> X(Points.size());
+        for (std::size_t i = 0; i < Points.size(); i++) X[i] = Points[i].x();
+        Update_Spline(X, X.data(), F_Value.data(), X.size());
+    }
+
+    template <int Order, class Scalar>
+    void Smoothing_Spline<Order, Scalar>::Update_Spline(const std::vector<double> &Knots,
+                                                const double *X, const double *F_Value, std::size_t Count)
+    {
+        if (Knots.size() < 2) throw std::runtime_error("The spline grid is not defined...");
+
+        int Num_Segments = Knots.size() - 1;
+        int Num_Dofs = (Num_Segments + 1) * Nodal_Dofs;
+
+        //нижняя половина ленты: элемент (r, c), c <= r, хранится в Band[r * (Band_Width + 1) + r - c]
+        std::vector<double> Band(Num_Dofs * (Band_Width + 1), 0.0);
+        //решение накапливается в double независимо от Scalar
+        std::vector<double> alpha(Num_Dofs, 0.0);
+
+        //добавление матрицы Coef * Phi * Phi^T элемента i
+        auto Add_Element = [&](int i, const double *Phi, double Coef)
+        {
+            for (int a = 0; a < Element_Dofs; a++)
+                for (int b = 0; b <= a; b++)
+                {
+                    int r = i * Nodal_Dofs + a, c = i * Nodal_Dofs + b;
+                    Band[r * (Band_Width + 1) + r - c] += Coef * Phi[a] * Phi[b];
+                }
+        };
+
+        //вклад точек данных
+        double eps = 1e-7;
+        for (std::size_t k = 0; k < Count; k++)
+        {
+            int i = Locate_Segment(Knots.begin(), Knots.end(), X[k]);
+            if (i < 0) throw std::runtime_error("The point is not found in the segments...");
+
+            //точка в общем узле входит в оба сегмента
+            int Last = (i + 1 < Num_Segments && std::fabs(X[k] - Knots[i + 1]) < eps) ? i + 1 : i;
+            for (; i <= Last; i++)
+            {
+                double W = 1.0, h = Knots[i + 1] - Knots[i], Phi[Element_Dofs];
+                Basis_Values<0>(std::min(std::max((X[k] - Knots[i]) / h, 0.0), 1.0), h, Phi);
+                Add_Element(i, Phi, (1.0 - SMOOTH) * W);
+                for (int a = 0; a < Element_Dofs; a++)
+                    alpha[i * Nodal_Dofs + a] += (1.0 - SMOOTH) * W * Phi[a] * F_Value[k];
+            }
+        }
+
+        //вклад от сглаживания: квадратура Гаусса по трём точкам (точна для многочленов до 5-й степени)
+        const double Gauss_T[3] = { 0.5 - 0.5 * std::sqrt(0.6), 0.5, 0.5 + 0.5 * std::sqrt(0.6) };
+        const double Gauss_W[3] = { 5.0 / 18.0, 8.0 / 18.0, 5.0 / 18.0 };
+        for (int i = 0; i < Num_Segments; i++)
+        {
+            double h = Knots[i + 1] - Knots[i];
+            if (!(h > 0.0)) throw std::runtime_error("The grid nodes must be in ascending order...");
+            for (int q = 0; q < 3; q++)
+            {
+                double Phi[Element_Dofs];
+                Basis_Values<Basis::Smoothing_Derivative>(Gauss_T[q], h, Phi);
+                Add_Element(i, Phi, SMOOTH * Gauss_W[q] * h);
+            }
+        }
+
+        //метод Холецкого для ленточной матрицы
+        for (int r = 0; r < Num_Dofs; r++)
+        {
+            for (int c = std::max(0, r - Band_Width); c <= r; c++)
+            {
+                double Sum = Band[r * (Band_Width + 1) + r - c];
+                for (int m = std::max(0, r - Band_Width); m < c; m++)
+                    Sum -= Band[r * (Band_Width + 1) + r - m] * Band[c * (Band_Width + 1) + c - m];
+                if (r == c)
+                {
+                    if (!(Sum > 0.0)) throw std::runtime_error("The system is degenerate: increase the smoothing parameter...");
+                    Band[r * (Band_Width + 1)] = std::sqrt(Sum);
+                }
+                else
+                    Band[r * (Band_Width + 1) + r - c] = Sum / Band[c * (Band_Width + 1)];
+            }
+        }
+
+        //прямой ход L y = b и обратный ход L^T x = y
+        for (int r = 0; r < Num_Dofs; r++)
+        {
+            for (int m = std::max(0, r - Band_Width); m < r; m++)
+                alpha[r] -= Band[r * (Band_Width + 1) + r - m] * alpha[m];
+            alpha[r] /= Band[r * (Band_Width + 1)];
+        }
+        for (int r = Num_Dofs - 1; r >= 0; r--)
+        {
+            for (int m = r + 1; m <= std::min(Num_Dofs - 1, r + Band_Width); m++)
+                alpha[r] -= Band[m * (Band_Width + 1) + m - r] * alpha[m];
+            alpha[r] /= Band[r * (Band_Width + 1)];
+        }
+
+        this->Knots.assign(Knots.begin(), Knots.end());
+        this->alpha.assign(alpha.begin(), alpha.end());
+    }
+
+    template <int Order, class Scalar>
+    void Smoothing_Spline<Order, Scalar>::Get_Value(const Point &P, double *Res) const
+    {
+        int i = Locate_Segment(Knots.begin(), Knots.end(), static_cast<Scalar>(P.x()));
+        if (i < 0) throw std::runtime_error("The point is not found in the segments...");
+
+        double h = static_cast<double>(Knots[i + 1]) - Knots[i];
+        double t = (P.x() - Knots[i]) / h;
+        double Phi[Element_Dofs], Der_Phi[Element_Dofs];
+        Basis_Values<0>(t, h, Phi);
+        Basis_Values<1>(t, h, Der_Phi);
+
+        const Scalar *a = alpha.data() + i * Nodal_Dofs;
+        Res[0] = Res[1] = 0.0;
+        for (int k = 0; k < Element_Dofs; k++)
+        {
+            Res[0] += a[k] * Phi[k];
+            Res[1] += a[k] * Der_Phi[k];
+        }
+        Res[2] = 0.0;
+    }
+
+    template <int Order, class Scalar>
+    void Smoothing_Spline<Order, Scalar>::Get_Values(const Scalar *X, std::size_t Count,
+                                                     Scalar *Values, Scalar *Derivatives) const
+    {
+        int i = -1;
+        for (std::size_t k = 0; k < Count; k++)
+        {
+            //сегмент предыдущей точки служит начальным приближением
+            i = Locate_Segment(Knots.begin(), Knots.end(), X[k], i);
+            if (i < 0) throw std::runtime_error("The point is not found in the segments...");
+
+            Scalar h = Knots[i + 1] - Knots[i];
+            Scalar t = (X[k] - Knots[i]) / h;
+            Scalar Phi[Element_Dofs];
+            const Scalar *a = alpha.data() + i * Nodal_Dofs;
+
+            Basis_Values<0>(t, h, Phi);
+            Scalar Value = 0;
+            for (int m = 0; m < Element_Dofs; m++) Value += a[m] * Phi[m];
+            Values[k] = Value;
+
+            if (Derivatives)
+            {
+                Basis_Values<1>(t, h, Phi);
+                Scalar Derivative = 0;
+                for (int m = 0; m < Element_Dofs; m++) Derivative += a[m] * Phi[m];
+                Derivatives[k] = Derivative;
+            }
+        }
+    }
+}
+
+#endif
\ No newline at end of file
@@ -2,15 +2,31 @@
 #ifndef SMOOTHING_SPLINE_1D_H
 #define SMOOTHING_SPLINE_1D_H
 
+#include <string>
 #include "Spline.h"
+#include "Tridiagonal_Solver.h"
 
 namespace Com_Methods {
     class Smoothing_Spline_1D : public Spline {
     private:
         double SMOOTH;  // параметр сглаживания p
-        std::vector<Point> Points;
+        std::vector<double> Knots; // координаты узлов сетки
         std::vector<double> alpha; // коэффициенты разложения
-        
+        // разложенная матрица: a - множители прямого хода прогонки, b - ведущие элементы, c - наддиагональ
+        std::vector<double> a, b, c;
+        // трёхдиагональный оператор правой части: строка i = Rhs_a[i]*F[i-1] + Rhs_b[i]*F[i] + Rhs_c[i]*F[i+1]
+        std::vector<double> Rhs_a, Rhs_b, Rhs_c;
+        double System_SMOOTH;      // параметр сглаживания, для которого собрана матрица
+        Tridiagonal_Solver Solver; // прогонка (последовательная или по блокам)
+        int Num_Threads;           // число потоков для прогонки
+        int Parallel_Threshold;    // минимальное число узлов для параллельной прогонки
+        bool Uniform_Grid;         // узлы образуют равномерную сетку
+        double Grid_Step;          // шаг равномерной сетки
+
+        // поиск сегмента, содержащего X; Guess - сегмент предыдущего запроса (-1, если его нет)
+        int Find_Segment(const double &X, int Guess = -1) const;
+        // сборка и разложение матрицы СЛАУ (зависит только от узлов и SMOOTH)
+        void Assemble_System();
         void Transition_To_Master_Element(int Seg_Num, const double &X, double &Ksi) const;
         double Basis_Function(int Number, const double &Ksi) const;
         double Der_Basis_Function(int Number, const double &Ksi) const;
@@ -19,7 +35,32 @@ namespace Com_Methods {
         Smoothing_Spline_1D(const double &SMOOTH = 0.5);
         void Update_Spline(const std::vector<Point> &Points, 
                           const std::vector<double> &F_Value) override;
+        // построение по массивам координат узлов и значений длины Count (без промежуточных Point);
+        // если узлы и SMOOTH не изменились, разложенная матрица используется повторно
+        void Update_Spline(const double *X, const double *F_Value, std::size_t Count);
         void Get_Value(const Point &P, double *Res) const override;
+        // пакетное вычисление значений и производных в Count точках (Derivatives может быть nullptr);
+        // для упорядоченных по возрастанию X сегменты находятся одним проходом по сетке
+        void Get_Values(const double *X, std::size_t Count, double *Values, double *Derivatives = nullptr) const;
+
+        // пересчёт коэффициентов для новых значений на той же сетке: один проход прогонки без пересборки матрицы
+        void Update_Values(const std::vector<double> &F_Value);
+        void Update_Values(const double *F_Value, std::size_t Count);
+        // решение для Num_Channels наборов значений сразу; F_Values и Alphas хранятся по узлам:
+        // элемент [i * Num_Channels + k] - узел i, канал k (массивы не должны пересекаться).
+        // Для линейного базиса коэффициенты совпадают со значениями сплайна в узлах
+        void Solve_Values(const double *F_Values, std::size_t Num_Channels, double *Alphas) const;
+
+        // параллельная прогонка в Num_Threads потоках для сеток не менее чем из Parallel_Threshold узлов
+        // (на меньших сетках - последовательная); матрица разлагается заново
+        void Set_Num_Threads(int Num_Threads, int Parallel_Threshold = 100000);
+        int Get_Num_Threads() const { return Num_Threads; }
+
+        // запись построенного сплайна (узлы, alpha, SMOOTH) в двоичный файл формата Spline_File_Header;
+        // для вычислений без копирования файл можно открыть через Mapped_Smoothing_Spline_1D
+        void Save(const std::string &File_Name) const;
+        // загрузка сплайна из файла; матрица СЛАУ собирается заново для последующих Update_Values
+        void Load(const std::string &File_Name);
         
         // Дополнительные методы для удобства
         void Set_Smoothing_Parameter(double p) { SMOOTH = p; }
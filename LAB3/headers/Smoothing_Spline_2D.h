@@ -0,0 +1,19 @@
+#pragma once
+#ifndef SMOOTHING_SPLINE_2D_H
+#define SMOOTHING_SPLINE_2D_H
+
+#include "Smoothing_Spline_Grid.h"
+
+namespace Com_Methods {
+    // сглаживающий сплайн на структурированной 2D сетке (X, Y) с полилинейным базисом
+    class Smoothing_Spline_2D : public Smoothing_Spline_Grid {
+    public:
+        Smoothing_Spline_2D(const double &SMOOTH = 0.5);
+        using Smoothing_Spline_Grid::Update_Spline;
+        // построение по узлам осей: F_Value[j * X.size() + i] - значение в узле (X[i], Y[j])
+        void Update_Spline(const std::vector<double> &X, const std::vector<double> &Y,
+                           const std::vector<double> &F_Value);
+    };
+}
+
+#endif
\ No newline at end of file
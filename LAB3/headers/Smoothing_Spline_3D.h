@@ -0,0 +1,20 @@
+#pragma once
+#ifndef SMOOTHING_SPLINE_3D_H
+#define SMOOTHING_SPLINE_3D_H
+
+#include "Smoothing_Spline_Grid.h"
+
+namespace Com_Methods {
+    // сглаживающий сплайн на структурированной 3D сетке (X, Y, Z) с полилинейным базисом;
+    // Get_Gradient возвращает значение и производные по x, y и z (массив из 4 элементов)
+    class Smoothing_Spline_3D : public Smoothing_Spline_Grid {
+    public:
+        Smoothing_Spline_3D(const double &SMOOTH = 0.5);
+        using Smoothing_Spline_Grid::Update_Spline;
+        // построение по узлам осей: F_Value[(k * Y.size() + j) * X.size() + i] - значение в узле (X[i], Y[j], Z[k])
+        void Update_Spline(const std::vector<double> &X, const std::vector<double> &Y, const std::vector<double> &Z,
+                           const std::vector<double> &F_Value);
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#ifndef SMOOTHING_SPLINE_GRID_H
+#define SMOOTHING_SPLINE_GRID_H
+
+#include "Spline.h"
+#include "Tensor_Product_System.h"
+
+namespace Com_Methods {
+    // сглаживающий сплайн на структурированной сетке размерности Dimension (1..3) с полилинейным базисом;
+    // общая часть Smoothing_Spline_2D и Smoothing_Spline_3D
+    class Smoothing_Spline_Grid : public Spline {
+    private:
+        int Dimension;
+        double SMOOTH;  // параметр сглаживания p
+        Tensor_Product_System System;
+        std::vector<double> alpha; // коэффициенты разложения (значения в узлах)
+        double Tolerance;          // относительная невязка метода сопряжённых градиентов
+        int Max_Iterations;
+        int Iterations;            // число итераций последнего решения
+
+        // при отсутствии сходимости за Max_Iterations итераций бросается исключение,
+        // сплайн остаётся непостроенным
+        void Solve(const std::vector<double> &F_Grid);
+
+    public:
+        Smoothing_Spline_Grid(int Dimension, const double &SMOOTH = 0.5);
+        // точки должны образовывать полную структурированную сетку (порядок произвольный)
+        void Update_Spline(const std::vector<Point> &Points,
+                           const std::vector<double> &F_Value) override;
+        // построение по узлам осей: первая ось меняется в F_Value быстрее всего
+        void Update_Spline(const std::vector<std::vector<double>> &Axes,
+                           const std::vector<double> &F_Value);
+        // Res[0] - значение, Res[1], Res[2] - производные по x и y (общий контракт Spline, 3 элемента)
+        void Get_Value(const Point &P, double *Res) const override;
+        // Res[0] - значение, Res[1..Dimension] - производные по осям (массив из Dimension + 1 элементов)
+        void Get_Gradient(const Point &P, double *Res) const;
+
+        void Set_Solver_Parameters(double Tolerance, int Max_Iterations);
+        int Get_Iterations() const { return Iterations; }
+        int Get_Dimension() const { return Dimension; }
+        void Set_Smoothing_Parameter(double p) { SMOOTH = p; }
+        double Get_Smoothing_Parameter() const { return SMOOTH; }
+    };
+}
+
+#endif
\ No newline at end of file
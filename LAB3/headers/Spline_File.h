@@ -0,0 +1,38 @@
+#pragma once
+#ifndef SPLINE_FILE_H
+#define SPLINE_FILE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Com_Methods {
+    // Двоичный формат построенного одномерного сплайна (версия 1):
+    //   заголовок Spline_File_Header (32 байта), затем Count узлов и Count коэффициентов alpha (double).
+    // Данные записываются в порядке байт машины; Byte_Order позволяет отвергнуть файл с другим порядком.
+    // Массивы выровнены на 8 байт от начала файла, поэтому их можно читать прямо из отображения в память.
+    struct Spline_File_Header {
+        char Magic[4];              // "SSPL"
+        std::uint32_t Version;      // версия формата
+        std::uint32_t Byte_Order;   // Spline_File_Byte_Order в порядке байт записавшей машины
+        std::uint32_t Basis_Order;  // порядок базиса (1 - линейный)
+        std::uint64_t Count;        // число узлов
+        double SMOOTH;              // параметр сглаживания
+    };
+    static_assert(sizeof(Spline_File_Header) == 32, "Unexpected spline file header size");
+
+    const std::uint32_t Spline_File_Version = 1;
+    const std::uint32_t Spline_File_Byte_Order = 0x01020304;
+
+    // запись сплайна с Count узлами
+    void Write_Spline_File(const std::string &File_Name, double SMOOTH,
+                           const double *Knots, const double *alpha, std::size_t Count);
+    // чтение сплайна в массивы
+    void Read_Spline_File(const std::string &File_Name, double &SMOOTH,
+                          std::vector<double> &Knots, std::vector<double> &alpha);
+    // проверка заголовка и соответствия размера файла числу узлов
+    void Check_Spline_File_Header(const Spline_File_Header &Header, std::uint64_t File_Size);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+#ifndef STREAMING_SMOOTHING_SPLINE_1D_H
+#define STREAMING_SMOOTHING_SPLINE_1D_H
+
+#include <deque>
+#include "Spline.h"
+
+namespace Com_Methods {
+    // Сглаживающий сплайн по скользящему окну из последних Window точек потока.
+    // СЛАУ та же, что у Smoothing_Spline_1D (линейный базис, точки данных в узлах).
+    // Прямой ход прогонки хранится для всего окна: при добавлении точки пересчитываются
+    // две последние строки, при удалении старой - строки от начала окна, пока ведущие элементы
+    // и правые части не совпадут с прежними с точностью Tolerance. Обратный ход выполняется
+    // только до затухания изменений коэффициентов (влияние изменения строки убывает
+    // геометрически), поэтому стоимость обновления определяется длиной затухания, а не размером окна.
+    // Коэффициенты совпадают с полным пересчётом по окну с точностью порядка 1e-13 * max|F| (проверено до p = 0.999).
+    class Streaming_Smoothing_Spline_1D : public Spline {
+    private:
+        double SMOOTH;           // параметр сглаживания p
+        std::size_t Window;      // максимальное число узлов в окне
+        double Tolerance;        // порог относительного изменения для остановки пересчёта
+
+        std::deque<double> X, F; // узлы и значения окна
+        std::deque<double> Pivot;// ведущие элементы прямого хода прогонки
+        std::deque<double> G;    // правая часть после прямого хода
+        std::deque<double> alpha;// коэффициенты разложения
+        // невозрастающая очередь кандидатов в максимум |F| по окну: первый элемент - масштаб
+        // абсолютного порога, выброс перестаёт влиять на порог, как только покидает окно
+        std::deque<double> Scale_Window;
+
+        // диагональ и правая часть строки i, наддиагональ (связь i и i + 1)
+        double Diagonal(std::size_t i) const;
+        double Right_Part(std::size_t i) const;
+        double Upper(std::size_t i) const;
+        // прямой ход для строки i по строке i - 1
+        void Forward_Row(std::size_t i, double &Piv, double &Rhs) const;
+        // обратный ход от строки From к началу окна
+        void Back_Substitution(std::size_t From);
+        bool Converged(double New_Value, double Old_Value, double Scale) const;
+        double Value_Scale() const { return Scale_Window.empty() ? 0.0 : Scale_Window.front(); }
+        void Push_Scale(double F_Value);
+        void Drop_Oldest();
+
+    public:
+        Streaming_Smoothing_Spline_1D(std::size_t Window, const double &SMOOTH = 0.5);
+
+        // замена окна: в нём остаются последние Window точек
+        void Update_Spline(const std::vector<Point> &Points,
+                           const std::vector<double> &F_Value) override;
+        void Get_Value(const Point &P, double *Res) const override;
+
+        // добавление точки потока (X должен быть больше последнего узла окна);
+        // при переполнении окна удаляется самая старая точка
+        void Append(double X, double F_Value);
+        std::size_t Size() const { return X.size(); }
+        void Set_Tolerance(double Tolerance) { this->Tolerance = Tolerance; }
+        double Get_Smoothing_Parameter() const { return SMOOTH; }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef TENSOR_PRODUCT_SYSTEM_H
+#define TENSOR_PRODUCT_SYSTEM_H
+
+#include <vector>
+#include <cstddef>
+#include "Point.h"
+
+namespace Com_Methods {
+    // СЛАУ сглаживающего сплайна на структурированной сетке (тензорное произведение одномерных сеток)
+    // с полилинейным базисом:
+    //   ((1 - p) * W + p * S) * alpha = (1 - p) * W * F,
+    // W - диагональ: число ячеек, содержащих узел (как в Smoothing_Spline_1D, где узел учитывается
+    // в каждом содержащем его сегменте), S - матрица сглаживания по первым производным
+    //   S = K_x (x) M_y (x) M_z + M_x (x) K_y (x) M_z + M_x (x) M_y (x) K_z,
+    // где K и M - трёхдиагональные одномерные матрицы жёсткости и масс.
+    // Матрица не хранится: произведение на вектор выполняется проходами одномерных трёхдиагональных
+    // операторов вдоль осей за O(N) операций и памяти, СЛАУ решается методом сопряжённых градиентов
+    // с диагональным предобусловливателем. Порядок узлов: первая ось меняется быстрее всего.
+    class Tensor_Product_System {
+    private:
+        std::vector<std::vector<double>> Axes;             // координаты узлов по осям
+        std::vector<std::vector<double>> Mass_b, Mass_c;   // одномерные матрицы масс (диагональ, наддиагональ)
+        std::vector<std::vector<double>> Stiff_b, Stiff_c; // одномерные матрицы жёсткости
+        std::vector<std::vector<double>> Count;            // число сегментов, содержащих узел оси
+        std::vector<std::size_t> Stride;
+        std::size_t Size;
+
+        // Out = T * In, T - трёхдиагональная матрица (b, c) вдоль оси Axis
+        void Apply_Axis(int Axis, const std::vector<double> &b, const std::vector<double> &c,
+                        const double *In, double *Out) const;
+        // Res = ((1 - p) * W + p * S) * U, Weight - диагональ W
+        void Apply(double p, const std::vector<double> &Weight, const double *U, double *Res,
+                   std::vector<double> &Buffer_1, std::vector<double> &Buffer_2) const;
+        double Data_Weight(std::size_t Node) const;
+
+    public:
+        Tensor_Product_System();
+
+        void Build(const std::vector<std::vector<double>> &Axes);
+        // решение СЛАУ для значений F; возвращает число итераций,
+        // Converged = false, если невязка не достигла Tolerance за Max_Iterations итераций
+        int Solve(double p, const std::vector<double> &F, std::vector<double> &alpha,
+                  double Tolerance, int Max_Iterations, bool &Converged) const;
+
+        std::size_t Get_Size() const { return Size; }
+        const std::vector<double> &Get_Axis(int Axis) const { return Axes[Axis]; }
+
+        // номер сегмента оси, содержащего X (правила как в Smoothing_Spline_1D), или -1
+        static int Find_Segment(const std::vector<double> &Axis, double X);
+        // разбор набора точек, образующих полную структурированную сетку размерности Dimension:
+        // координаты узлов по осям и перестановка значений в порядок узлов сетки
+        static void Grid_From_Points(const std::vector<Point> &Points, const std::vector<double> &F_Value,
+                                     int Dimension, std::vector<std::vector<double>> &Axes,
+                                     std::vector<double> &F_Grid);
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+#ifndef TRIDIAGONAL_SOLVER_H
+#define TRIDIAGONAL_SOLVER_H
+
+#include <vector>
+#include <cstddef>
+
+namespace Com_Methods {
+    // Метод прогонки для СЛАУ с трёхдиагональной матрицей: a - поддиагональ (a[0] не используется),
+    // b - диагональ, c - наддиагональ (c[n-1] не используется).
+    // При Num_Blocks > 1 используется параллельный вариант с разбиением на блоки:
+    // блоки разделены одиночными строками-разделителями, каждый блок разлагается в своём потоке,
+    // значения в разделителях находятся из редуцированной трёхдиагональной СЛАУ размера Num_Blocks - 1.
+    // Для матриц с диагональным преобладанием результат совпадает с последовательной прогонкой
+    // с относительной погрешностью порядка 1e-13 (без выбора ведущего элемента, как и прогонка).
+    class Tridiagonal_Solver {
+    private:
+        int N;                      // размер системы
+        std::vector<long long> Start; // Start[k] - первая строка блока k, Start[k + 1] - 1 - разделитель
+        std::vector<double> V, W;   // "спайки": решения блоков для связей с левым и правым разделителем
+        std::vector<double> Red_a, Red_b, Red_c; // разложенная редуцированная СЛАУ для разделителей
+
+        // границы строк блока k (без разделителя)
+        void Block_Rows(int k, long long &From, long long &To) const;
+
+    public:
+        Tridiagonal_Solver();
+
+        // разложение на месте: в a записываются множители прямого хода, в b - ведущие элементы
+        void Factorize(double *a, double *b, const double *c, int n, int Num_Blocks = 1);
+        // решение для Num_Channels правых частей сразу (R[i * Num_Channels + k] - строка i, канал k);
+        // a, b, c - массивы, разложенные Factorize; решение записывается в R
+        void Solve(const double *a, const double *b, const double *c, double *R, std::size_t Num_Channels = 1) const;
+
+        int Get_Num_Blocks() const { return static_cast<int>(Start.size()) - 1; }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -1,10 +1,13 @@
 #include <iostream>
 #include <vector>
 #include <cmath>
+#include <algorithm>
 #include <random>
 #include <fstream>
 #include <string>
 #include "Smoothing_Spline_1D.h"
+#include "Smoothing_Spline.h"
+#include "Smoothing_Parameter_Selector.h"
 
 
 using namespace Com_Methods;
@@ -98,15 +101,20 @@ void save_spline_comparison(const std::vector<Point>& points,
     }
 
     int num_points = points.size();
+    std::vector<double> xs(num_points);
+    for (int i = 0; i < num_points; ++i) xs[i] = points[i].x();
+
+    std::vector<std::vector<double>> spline_values(smoothing_splines.size(), std::vector<double>(num_points));
+    for (size_t s = 0; s < smoothing_splines.size(); ++s) {
+        smoothing_splines[s].Get_Values(xs.data(), xs.size(), spline_values[s].data());
+    }
+
     for (int i = 0; i < num_points; ++i) {
-        double x = points[i].x();
+        double x = xs[i];
         file << x << "," << values[i];
 
-        for (auto& spline : smoothing_splines) {
-            Point p(x, 0, 0);
-            double result[3];
-            spline.Get_Value(p, result);
-            file << "," << result[0];
+        for (auto& spline_value : spline_values) {
+            file << "," << spline_value[i];
         }
 
         Point p(x, 0, 0);
@@ -121,6 +129,46 @@ void save_spline_comparison(const std::vector<Point>& points,
     file.close();
 }
 
+// Сплайны с базисом заданного порядка: линейный на узлах в точках данных должен
+// совпадать с Smoothing_Spline_1D, кубический строится на сетке в 10 раз реже
+void compare_basis_orders(const std::vector<Point>& points,
+    const std::vector<double>& values, double p) {
+    std::cout << "\n--- Basis order comparison (p=" << p << ") ---" << std::endl;
+
+    int num_points = points.size();
+    std::vector<double> xs(num_points);
+    for (int i = 0; i < num_points; ++i) xs[i] = points[i].x();
+
+    Smoothing_Spline_1D reference(p);
+    reference.Update_Spline(points, values);
+    Linear_Smoothing_Spline linear(p);
+    linear.Update_Spline(points, values);
+
+    std::vector<double> reference_values(num_points), linear_values(num_points);
+    reference.Get_Values(xs.data(), xs.size(), reference_values.data());
+    linear.Get_Values(xs.data(), xs.size(), linear_values.data());
+
+    double max_difference = 0.0;
+    for (int i = 0; i < num_points; ++i)
+        max_difference = std::max(max_difference, std::abs(linear_values[i] - reference_values[i]));
+    std::cout << "Linear basis vs Smoothing_Spline_1D: max |difference| = " << max_difference << std::endl;
+
+    std::vector<double> knots;
+    for (int i = 0; i < num_points; i += 10) knots.push_back(xs[i]);
+    if (knots.back() != xs.back()) knots.push_back(xs.back());
+
+    Cubic_Smoothing_Spline cubic(p);
+    cubic.Update_Spline(knots, xs.data(), values.data(), xs.size());
+    std::vector<double> cubic_values(num_points);
+    cubic.Get_Values(xs.data(), xs.size(), cubic_values.data());
+
+    double sum_sq = 0.0;
+    for (int i = 0; i < num_points; ++i)
+        sum_sq += (cubic_values[i] - values[i]) * (cubic_values[i] - values[i]);
+    std::cout << "Cubic basis on " << knots.size() << " knots: RMS residual = "
+              << std::sqrt(sum_sq / num_points) << std::endl;
+}
+
 void analyze_smoothing_parameter(const std::vector<Point>& points,
     const std::vector<double>& values,
     const std::vector<double>& p_values) {
@@ -134,33 +182,24 @@ void analyze_smoothing_parameter(const std::vector<Point>& points,
         return;
     }
 
-    analysis_file << "p_value,Average_Deviation,Max_Deviation\n";
+    analysis_file << "p_value,Average_Deviation,Max_Deviation,GCV\n";
 
-    for (double p : p_values) {
-        std::cout << "Analyzing p=" << p << "..." << std::endl;
-        Smoothing_Spline_1D smoothing_spline(p);
-        smoothing_spline.Update_Spline(points, values);
-
-        double total_deviation = 0.0;
-        double max_deviation = 0.0;
-        int count = points.size();
-
-        for (int i = 0; i < count; i++) {
-            Point test_point(points[i].x(), 0, 0);
-            double result[3];
-            smoothing_spline.Get_Value(test_point, result);
-
-            double deviation = std::abs(result[0] - values[i]);
-            total_deviation += deviation;
-            if (deviation > max_deviation) {
-                max_deviation = deviation;
-            }
-        }
+    Smoothing_Parameter_Selector selector(points, values);
+    std::vector<Smoothing_Parameter_Score> scores = selector.Sweep(p_values, Selection_Criterion::GCV);
+    for (const auto& score : scores) {
+        std::cout << "Analyzing p=" << score.SMOOTH << "..." << std::endl;
+        analysis_file << score.SMOOTH << "," << score.Average_Deviation << ","
+                      << score.Max_Deviation << "," << score.Score << "\n";
+    }
 
-        double avg_deviation = total_deviation / count;
-        analysis_file << p << "," << avg_deviation << "," << max_deviation << "\n";
+    // Автоматический выбор p по сетке значений
+    std::vector<double> p_grid;
+    for (int i = 1; i < 500; ++i) p_grid.push_back(i / 500.0);
 
-    }
+    Smoothing_Parameter_Score best_gcv = selector.Find_Optimal(p_grid, Selection_Criterion::GCV);
+    Smoothing_Parameter_Score best_cv = selector.Find_Optimal(p_grid, Selection_Criterion::Cross_Validation);
+    std::cout << "Optimal p (GCV): " << best_gcv.SMOOTH << ", score = " << best_gcv.Score << std::endl;
+    std::cout << "Optimal p (5-fold CV): " << best_cv.SMOOTH << ", score = " << best_cv.Score << std::endl;
 
     analysis_file.close();
 }
@@ -197,6 +236,8 @@ int main() {
     std::cout << "\n--- Step 3: Saving spline data for visualization ---" << std::endl;
     save_spline_comparison(random_points, random_values, p_values);
 
+    compare_basis_orders(random_points, random_values, 0.3);
+
     analyze_smoothing_parameter(random_points, random_values, p_values);
     return 0;
 }
@@ -0,0 +1,135 @@
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include "Mapped_Smoothing_Spline_1D.h"
+#include "Spline_File.h"
+#include "Segment_Search.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Com_Methods
+{
+
+	Mapped_Smoothing_Spline_1D::Mapped_Smoothing_Spline_1D(const std::string &File_Name)
+	{
+		Data = nullptr;
+		Data_Size = 0;
+		Mapping_Handle = nullptr;
+
+		//отображение файла в память только для чтения
+#ifdef _WIN32
+		HANDLE File = CreateFileA(File_Name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+								  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File == INVALID_HANDLE_VALUE) throw std::runtime_error("The spline file cannot be opened...");
+		LARGE_INTEGER Size;
+		if (!GetFileSizeEx(File, &Size) || Size.QuadPart < static_cast<LONGLONG>(sizeof(Spline_File_Header)))
+		{
+			CloseHandle(File);
+			throw std::runtime_error("The file is not a spline file...");
+		}
+		Data_Size = static_cast<std::size_t>(Size.QuadPart);
+		HANDLE Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(File);
+		if (!Mapping) throw std::runtime_error("The spline file cannot be mapped...");
+		Mapping_Handle = Mapping;
+		Data = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!Data)
+		{
+			Unmap();
+			throw std::runtime_error("The spline file cannot be mapped...");
+		}
+#else
+		int File = open(File_Name.c_str(), O_RDONLY);
+		if (File < 0) throw std::runtime_error("The spline file cannot be opened...");
+		struct stat Info;
+		if (fstat(File, &Info) != 0 || Info.st_size < static_cast<off_t>(sizeof(Spline_File_Header)))
+		{
+			close(File);
+			throw std::runtime_error("The file is not a spline file...");
+		}
+		Data_Size = static_cast<std::size_t>(Info.st_size);
+		Data = mmap(nullptr, Data_Size, PROT_READ, MAP_SHARED, File, 0);
+		//дескриптор не нужен после создания отображения
+		close(File);
+		if (Data == MAP_FAILED)
+		{
+			Data = nullptr;
+			throw std::runtime_error("The spline file cannot be mapped...");
+		}
+#endif
+
+		const Spline_File_Header *Header = static_cast<const Spline_File_Header*>(Data);
+		try
+		{
+			Check_Spline_File_Header(*Header, Data_Size);
+		}
+		catch (...)
+		{
+			Unmap();
+			throw;
+		}
+
+		Count = static_cast<std::size_t>(Header->Count);
+		SMOOTH = Header->SMOOTH;
+		Knots = reinterpret_cast<const double*>(static_cast<const char*>(Data) + sizeof(Spline_File_Header));
+		alpha = Knots + Count;
+	}
+
+	Mapped_Smoothing_Spline_1D::~Mapped_Smoothing_Spline_1D()
+	{
+		Unmap();
+	}
+
+	void Mapped_Smoothing_Spline_1D::Unmap()
+	{
+#ifdef _WIN32
+		if (Data) UnmapViewOfFile(Data);
+		if (Mapping_Handle) CloseHandle(static_cast<HANDLE>(Mapping_Handle));
+#else
+		if (Data) munmap(Data, Data_Size);
+#endif
+		Data = nullptr;
+		Mapping_Handle = nullptr;
+	}
+
+	void Mapped_Smoothing_Spline_1D::Update_Spline(const std::vector<Point> &,
+												   const std::vector<double> &)
+	{
+		throw std::runtime_error("The mapped spline is read-only...");
+	}
+
+	int Mapped_Smoothing_Spline_1D::Find_Segment(double X, int Guess) const
+	{
+		return Locate_Segment(Knots, Knots + Count, X, Guess);
+	}
+
+	void Mapped_Smoothing_Spline_1D::Get_Value(const Point &P, double *Res) const
+	{
+		double X = P.x();
+		Get_Values(&X, 1, Res, Res + 1);
+		Res[2] = 0.0;
+	}
+
+	void Mapped_Smoothing_Spline_1D::Get_Values(const double *X, std::size_t Count, double *Values, double *Derivatives) const
+	{
+		int i = -1;
+		for (std::size_t k = 0; k < Count; k++)
+		{
+			i = Find_Segment(X[k], i);
+			if (i < 0) throw std::runtime_error("The point is not found in the segments...");
+
+			//линейный базис на сегменте [Knots[i], Knots[i + 1]]
+			double h = Knots[i + 1] - Knots[i];
+			double Ksi = 2.0 * (X[k] - Knots[i]) / h - 1.0;
+			Values[k] = alpha[i] * 0.5 * (1 - Ksi) + alpha[i + 1] * 0.5 * (1 + Ksi);
+			if (Derivatives) Derivatives[k] = (alpha[i] * (-0.5) + alpha[i + 1] * 0.5) * 2.0 / h;
+		}
+	}
+}
\ No newline at end of file
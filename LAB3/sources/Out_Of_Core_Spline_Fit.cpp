@@ -0,0 +1,178 @@
+#include <stdexcept>
+#include <fstream>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include "Out_Of_Core_Spline_Fit.h"
+#include "Spline_File.h"
+
+namespace Com_Methods
+{
+	namespace
+	{
+		//временный файл закрывается и удаляется при любом выходе из Fit, в том числе по исключению
+		struct Temporary_File_Guard
+		{
+			std::fstream &Stream;
+			std::string Name;
+			~Temporary_File_Guard()
+			{
+				Stream.close();
+				std::remove(Name.c_str());
+			}
+		};
+	}
+
+	Out_Of_Core_Spline_Fit::Out_Of_Core_Spline_Fit(const double &SMOOTH, std::size_t Chunk_Size)
+	{
+		this->SMOOTH = SMOOTH;
+		Set_Chunk_Size(Chunk_Size);
+	}
+
+	void Out_Of_Core_Spline_Fit::Set_Chunk_Size(std::size_t Chunk_Size)
+	{
+		if (Chunk_Size < 1) throw std::runtime_error("The chunk size must be positive...");
+		this->Chunk_Size = Chunk_Size;
+	}
+
+	std::size_t Out_Of_Core_Spline_Fit::Fit(const std::string &Data_File, const std::string &Spline_File) const
+	{
+		std::ifstream Data(Data_File, std::ios::binary | std::ios::ate);
+		if (!Data) throw std::runtime_error("The data file cannot be opened...");
+		std::uint64_t Data_Size = static_cast<std::uint64_t>(Data.tellg());
+		Data.seekg(0);
+		if (Data_Size % (2 * sizeof(double)) != 0) throw std::runtime_error("The data file is damaged...");
+		std::uint64_t Count = Data_Size / (2 * sizeof(double));
+		if (Count < 2) throw std::runtime_error("The spline grid is not defined...");
+
+		std::string Work_Name = Work_File.empty() ? Spline_File + ".tmp" : Work_File;
+		std::fstream Work(Work_Name, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+		Temporary_File_Guard Work_Guard{ Work, Work_Name };
+		//результат пишется в <результат>.part и переименовывается только после успешного построения,
+		//так что при ошибке не остаётся файла с корректным заголовком и неполными данными
+		std::string Part_Name = Spline_File + ".part";
+		std::fstream Out(Part_Name, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+		Temporary_File_Guard Out_Guard{ Out, Part_Name };
+		if (!Work || !Out) throw std::runtime_error("The spline file cannot be created...");
+
+		//заголовок записывается заранее, узлы идут сразу за ним, alpha - после узлов
+		Spline_File_Header Header;
+		std::memcpy(Header.Magic, "SSPL", 4);
+		Header.Version = Spline_File_Version;
+		Header.Byte_Order = Spline_File_Byte_Order;
+		Header.Basis_Order = 1;
+		Header.Count = Count;
+		Header.SMOOTH = SMOOTH;
+		Out.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+		std::size_t Chunk_Size = static_cast<std::size_t>(std::min<std::uint64_t>(this->Chunk_Size, Count));
+		std::vector<double> Input(2 * Chunk_Size); // блок пар (x, f)
+		std::vector<double> Rows(3 * Chunk_Size);  // ведущий элемент, наддиагональ, правая часть строк блока
+		std::vector<double> Knots(Chunk_Size);     // узлы блока
+		std::size_t Input_Size = 0, Input_Pos = 0, Row_Count = 0;
+		std::uint64_t Read = 0;
+
+		//чтение следующей точки данных
+		auto Next_Point = [&](double &X, double &F)
+		{
+			if (Input_Pos == Input_Size)
+			{
+				Input_Size = static_cast<std::size_t>(std::min<std::uint64_t>(Chunk_Size, Count - Read));
+				Data.read(reinterpret_cast<char*>(Input.data()), Input_Size * 2 * sizeof(double));
+				if (!Data) throw std::runtime_error("Error reading the data file...");
+				Read += Input_Size;
+				Input_Pos = 0;
+			}
+			X = Input[2 * Input_Pos];
+			F = Input[2 * Input_Pos + 1];
+			Input_Pos++;
+		};
+
+		//сброс блока строк прямого хода и узлов на диск
+		auto Flush = [&]()
+		{
+			Work.write(reinterpret_cast<const char*>(Rows.data()), Row_Count * 3 * sizeof(double));
+			Out.write(reinterpret_cast<const char*>(Knots.data()), Row_Count * sizeof(double));
+			if (!Work || !Out) throw std::runtime_error("Error writing the spline file...");
+			Row_Count = 0;
+		};
+
+		//прямой ход прогонки; СЛАУ та же, что собирает Smoothing_Spline_1D при точках данных в узлах:
+		//диагональ (1 - p) * W * n_i + p / h_{i-1} + p / h_i, наддиагональ -p / h_i,
+		//правая часть (1 - p) * W * n_i * F_i, n_i - число сегментов, содержащих узел i
+		double W = 1.0;
+		double X_Prev = 0.0, X_Cur, F_Cur, X_Next = 0.0, F_Next = 0.0;
+		double Upper_Prev = 0.0, Pivot_Prev = 1.0, G_Prev = 0.0;
+		Next_Point(X_Cur, F_Cur);
+		for (std::uint64_t i = 0; i < Count; i++)
+		{
+			bool Has_Next = i + 1 < Count;
+			if (Has_Next)
+			{
+				Next_Point(X_Next, F_Next);
+				if (!(X_Next > X_Cur)) throw std::runtime_error("The grid nodes must be in ascending order...");
+			}
+
+			int Num_Segments = (i > 0) + Has_Next;
+			double Diagonal = (1.0 - SMOOTH) * W * Num_Segments, Upper = 0.0;
+			if (i > 0) Diagonal += SMOOTH / (X_Cur - X_Prev);
+			if (Has_Next)
+			{
+				Diagonal += SMOOTH / (X_Next - X_Cur);
+				Upper = -SMOOTH / (X_Next - X_Cur);
+			}
+			double G = (1.0 - SMOOTH) * W * Num_Segments * F_Cur;
+
+			//исключение поддиагонального элемента (равного наддиагонали предыдущей строки)
+			double Pivot = Diagonal;
+			if (i > 0)
+			{
+				double Factor = Upper_Prev / Pivot_Prev;
+				Pivot -= Factor * Upper_Prev;
+				G -= Factor * G_Prev;
+			}
+
+			Rows[3 * Row_Count] = Pivot;
+			Rows[3 * Row_Count + 1] = Upper;
+			Rows[3 * Row_Count + 2] = G;
+			Knots[Row_Count++] = X_Cur;
+			if (Row_Count == Chunk_Size) Flush();
+
+			Upper_Prev = Upper; Pivot_Prev = Pivot; G_Prev = G;
+			X_Prev = X_Cur; X_Cur = X_Next; F_Cur = F_Next;
+		}
+		Flush();
+
+		//обратный ход по блокам с конца; alpha записываются после узлов
+		std::vector<double> &alpha = Knots;
+		double alpha_Next = 0.0;
+		std::uint64_t To = Count;
+		while (To > 0)
+		{
+			std::uint64_t From = To > Chunk_Size ? To - Chunk_Size : 0;
+			std::size_t Size = static_cast<std::size_t>(To - From);
+
+			Work.seekg(static_cast<std::streamoff>(From * 3 * sizeof(double)));
+			Work.read(reinterpret_cast<char*>(Rows.data()), Size * 3 * sizeof(double));
+			if (!Work) throw std::runtime_error("Error reading the work file...");
+
+			for (std::size_t k = Size; k-- > 0;)
+			{
+				alpha[k] = (Rows[3 * k + 2] - Rows[3 * k + 1] * alpha_Next) / Rows[3 * k];
+				alpha_Next = alpha[k];
+			}
+
+			Out.seekp(static_cast<std::streamoff>(sizeof(Header) + (Count + From) * sizeof(double)));
+			Out.write(reinterpret_cast<const char*>(alpha.data()), Size * sizeof(double));
+			if (!Out) throw std::runtime_error("Error writing the spline file...");
+			To = From;
+		}
+
+		Out.close();
+		if (!Out) throw std::runtime_error("Error writing the spline file...");
+		std::remove(Spline_File.c_str());
+		if (std::rename(Part_Name.c_str(), Spline_File.c_str()) != 0) throw std::runtime_error("The spline file cannot be created...");
+		return static_cast<std::size_t>(Count);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include <stdexcept>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include "Smoothing_Parameter_Selector.h"
+#include "Parallel_For.h"
+
+namespace Com_Methods
+{
+
+	Smoothing_Parameter_Selector::Smoothing_Parameter_Selector(const std::vector<Point> &Points,
+															   const std::vector<double> &F_Value)
+	{
+		if (Points.size() < 2 || Points.size() != F_Value.size())
+			throw std::runtime_error("Wrong data for the smoothing parameter selection...");
+
+		int Num_Segments = Points.size() - 1;
+		F = F_Value;
+		Data_Weight.assign(Num_Segments + 1, 0.0);
+		Stiff_b.assign(Num_Segments + 1, 0.0);
+		Stiff_c.assign(Num_Segments + 1, 0.0);
+
+		//сборка частей СЛАУ, не зависящих от p (как в Smoothing_Spline_1D: точки данных совпадают с узлами)
+		for (int i = 0; i < Num_Segments; i++)
+		{
+			double W = 1.0;
+			Data_Weight[i]     += W;
+			Data_Weight[i + 1] += W;
+
+			double h = Points[i + 1].x() - Points[i].x();
+			Stiff_b[i]     += 1.0 / h;
+			Stiff_b[i + 1] += 1.0 / h;
+			Stiff_c[i]     -= 1.0 / h;
+		}
+
+		unsigned int Hardware_Threads = std::thread::hardware_concurrency();
+		Num_Threads = Hardware_Threads > 0 ? Hardware_Threads : 1;
+		Num_Folds = 5;
+	}
+
+	double Smoothing_Parameter_Selector::Weight(int i, int Fold) const
+	{
+		return (Fold >= 0 && i % Num_Folds == Fold) ? 0.0 : Data_Weight[i];
+	}
+
+	bool Smoothing_Parameter_Selector::Fit(double p, int Fold, std::vector<double> &Alpha, std::vector<double> &Pivot) const
+	{
+		int n = F.size();
+
+		//метод прогонки: прямой ход
+		for (int i = 0; i < n; i++)
+		{
+			double d = (1.0 - p) * Weight(i, Fold) + p * Stiff_b[i];
+			double r = (1.0 - p) * Weight(i, Fold) * F[i];
+			if (i > 0)
+			{
+				double m = p * Stiff_c[i - 1] / Pivot[i - 1];
+				d -= m * p * Stiff_c[i - 1];
+				r -= m * Alpha[i - 1];
+			}
+			if (!(d > 0.0)) return false;
+			Pivot[i] = d;
+			Alpha[i] = r;
+		}
+
+		//обратный ход
+		Alpha[n - 1] /= Pivot[n - 1];
+		for (int i = n - 2; i >= 0; i--)
+			Alpha[i] = (Alpha[i] - p * Stiff_c[i] * Alpha[i + 1]) / Pivot[i];
+		return true;
+	}
+
+	std::vector<Smoothing_Parameter_Score> Smoothing_Parameter_Selector::Sweep(const std::vector<double> &P_Values,
+																			   Selection_Criterion Criterion) const
+	{
+		if (Criterion == Selection_Criterion::Cross_Validation && (Num_Folds < 2 || Num_Folds > (int)F.size()))
+			throw std::runtime_error("Wrong number of the cross-validation folds...");
+
+		int n = F.size();
+		const double Inf = std::numeric_limits<double>::infinity();
+		std::vector<Smoothing_Parameter_Score> Scores(P_Values.size());
+
+		Parallel_For(Num_Threads, 0, P_Values.size(), [&](long long From, long long To)
+		{
+			//рабочие массивы потока
+			std::vector<double> Alpha(n), Pivot(n), Back(n);
+
+			for (long long k = From; k < To; k++)
+			{
+				double p = P_Values[k];
+				Smoothing_Parameter_Score &Result = Scores[k];
+				Result.SMOOTH = p;
+				Result.Score = Result.Average_Deviation = Result.Max_Deviation = Inf;
+
+				if (!Fit(p, -1, Alpha, Pivot)) continue;
+
+				double Total_Deviation = 0.0, Max_Deviation = 0.0, RSS = 0.0, Weight_Sum = 0.0;
+				for (int i = 0; i < n; i++)
+				{
+					double Deviation = std::fabs(Alpha[i] - F[i]);
+					Total_Deviation += Deviation;
+					if (Deviation > Max_Deviation) Max_Deviation = Deviation;
+					RSS += Data_Weight[i] * Deviation * Deviation;
+					Weight_Sum += Data_Weight[i];
+				}
+				Result.Average_Deviation = Total_Deviation / n;
+				Result.Max_Deviation = Max_Deviation;
+
+				if (Criterion == Selection_Criterion::GCV)
+				{
+					//след матрицы влияния A = (1 - p) * S^(-1) * D; диагональ S^(-1) находится
+					//по ведущим элементам прямого (Pivot) и обратного (Back) хода прогонки
+					for (int i = n - 1; i >= 0; i--)
+					{
+						Back[i] = (1.0 - p) * Data_Weight[i] + p * Stiff_b[i];
+						if (i < n - 1) Back[i] -= p * Stiff_c[i] * p * Stiff_c[i] / Back[i + 1];
+					}
+					double Trace = 0.0;
+					for (int i = 0; i < n; i++)
+					{
+						double d = (1.0 - p) * Data_Weight[i] + p * Stiff_b[i];
+						Trace += (1.0 - p) * Data_Weight[i] / (Pivot[i] + Back[i] - d);
+					}
+
+					double Denominator = 1.0 - Trace / n;
+					if (Denominator > 1e-12)
+						Result.Score = RSS / Weight_Sum / (Denominator * Denominator);
+				}
+				else
+				{
+					//k-кратная кросс-валидация: прогноз в выброшенных узлах по сплайну без них
+					double Error = 0.0;
+					bool Regular = true;
+					for (int Fold = 0; Fold < Num_Folds && Regular; Fold++)
+					{
+						Regular = Fit(p, Fold, Alpha, Pivot);
+						for (int i = Fold; i < n && Regular; i += Num_Folds)
+							Error += (Alpha[i] - F[i]) * (Alpha[i] - F[i]);
+					}
+					if (Regular) Result.Score = Error / n;
+				}
+			}
+		});
+
+		return Scores;
+	}
+
+	Smoothing_Parameter_Score Smoothing_Parameter_Selector::Find_Optimal(const std::vector<double> &P_Values,
+																		 Selection_Criterion Criterion) const
+	{
+		if (P_Values.empty()) throw std::runtime_error("The list of smoothing parameters is empty...");
+
+		std::vector<Smoothing_Parameter_Score> Scores = Sweep(P_Values, Criterion);
+		std::size_t Best = 0;
+		for (std::size_t k = 1; k < Scores.size(); k++)
+			if (Scores[k].Score < Scores[Best].Score) Best = k;
+		return Scores[Best];
+	}
+}
\ No newline at end of file
@@ -1,7 +1,11 @@
 #include <functional>
 #include <stdexcept>
 #include <cmath>
+#include <algorithm>
 #include "Smoothing_Spline_1D.h"
+#include "Parallel_For.h"
+#include "Spline_File.h"
+#include "Segment_Search.h"
 #include <iostream>
 
 namespace Com_Methods
@@ -10,11 +14,16 @@ namespace Com_Methods
 	Smoothing_Spline_1D::Smoothing_Spline_1D(const double &SMOOTH)
 	{
 		this->SMOOTH = SMOOTH;
+		System_SMOOTH = SMOOTH;
+		Num_Threads = 1;
+		Parallel_Threshold = 100000;
+		Uniform_Grid = false;
+		Grid_Step = 0.0;
 	}
 
 	void Smoothing_Spline_1D::Transition_To_Master_Element(int Seg_Num, const double &X, double &Ksi) const
 	{
-		Ksi = 2.0 * (X - Points[Seg_Num].x()) / (Points[Seg_Num + 1].x() - Points[Seg_Num].x()) - 1.0;
+		Ksi = 2.0 * (X - Knots[Seg_Num]) / (Knots[Seg_Num + 1] - Knots[Seg_Num]) - 1.0;
 	}
 
 	double Smoothing_Spline_1D::Basis_Function(int Number, const double &Ksi) const
@@ -41,22 +50,42 @@ namespace Com_Methods
 	void Smoothing_Spline_1D::Update_Spline(const std::vector<Point>  & Points,
 											const std::vector<double> & F_Value)
 	{
-		this->Points.clear();
-		for (auto & elem : Points) this->Points.push_back(elem);
+		if (F_Value.size() != Points.size()) throw std::runtime_error("The number of values does not match the grid...");
 
-		int Num_Segments = Points.size() - 1;
+		//     x
+		std::vector<double> X(Points.size());
+		for (std::size_t i = 0; i < Points.size(); i++) X[i] = Points[i].x();
 
-		//   
-		alpha.resize(Num_Segments + 1);
+		Update_Spline(X.data(), F_Value.data(), X.size());
+	}
+
+	void Smoothing_Spline_1D::Update_Spline(const double *X, const double *F_Value, std::size_t Count)
+	{
+		if (Count < 2) throw std::runtime_error("The spline grid is not defined...");
+
+		//       SMOOTH    
+		if (Count != Knots.size() || System_SMOOTH != SMOOTH || !std::equal(X, X + Count, Knots.begin()))
+		{
+			Knots.assign(X, X + Count);
+			Assemble_System();
+		}
+		Update_Values(F_Value, Count);
+	}
+
+	void Smoothing_Spline_1D::Assemble_System()
+	{
+		int Num_Segments = Knots.size() - 1;
 
 		// 
-		std::vector <double> a, b, c;
-		a.resize(Num_Segments + 1); b.resize(Num_Segments + 1); c.resize(Num_Segments + 1);
-		
-		std::function<void(int Num_Segment, const Point &P, const double &F_Val, const double &w)> 
-		Assembling = [&](int i, const Point &P, const double &F_Val, const double &w)
+		a.assign(Num_Segments + 1, 0.0); b.assign(Num_Segments + 1, 0.0); c.assign(Num_Segments + 1, 0.0);
+		//   
+		Rhs_a.assign(Num_Segments + 1, 0.0); Rhs_b.assign(Num_Segments + 1, 0.0); Rhs_c.assign(Num_Segments + 1, 0.0);
+
+		//k -    (k = i  k = i + 1),    i
+		std::function<void(int Num_Segment, int Num_Point, const double &w)> 
+		Assembling = [&](int i, int k, const double &w)
 		{
-			double X = P.x(), Ksi;
+			double X = Knots[k], Ksi;
 		    Transition_To_Master_Element(i, X, Ksi);
 			double f1 = Basis_Function(1, Ksi);
 			double f2 = Basis_Function(2, Ksi);
@@ -66,8 +95,17 @@ namespace Com_Methods
 			a[i + 1] += (1.0 - SMOOTH) * w * f1 * f2;
 			c[i]	 += (1.0 - SMOOTH) * w * f2 * f1;
 			
-			alpha[i]     += (1.0 - SMOOTH) * w * f1 * F_Val;
-			alpha[i + 1] += (1.0 - SMOOTH) * w * f2 * F_Val;
+			// F[k]   i  i + 1  
+			if (k == i)
+			{
+				Rhs_b[i]     += (1.0 - SMOOTH) * w * f1;
+				Rhs_a[i + 1] += (1.0 - SMOOTH) * w * f2;
+			}
+			else
+			{
+				Rhs_c[i]     += (1.0 - SMOOTH) * w * f1;
+				Rhs_b[i + 1] += (1.0 - SMOOTH) * w * f2;
+			}
 		};
 
 		//   :      
@@ -75,61 +113,136 @@ namespace Com_Methods
 		{
 			//    
 			double W = 1.0;
-			Assembling(i, this->Points[i], F_Value[i], W);
-			Assembling(i, this->Points[i + 1], F_Value[i + 1], W);
+			Assembling(i, i, W);
+			Assembling(i, i + 1, W);
 
 			//     
-			double h = Points[i + 1].x() - Points[i].x();
+			double h = Knots[i + 1] - Knots[i];
 			b[i]	 += 1.0 / h * SMOOTH;
 			b[i + 1] += 1.0 / h * SMOOTH;
 			a[i + 1] -= 1.0 / h * SMOOTH;
 			c[i]	 -= 1.0 / h * SMOOTH;
 		}
 
-		for (int j = 1; j < Num_Segments + 1; j++)
-		{
-			//
-			b[j] -= a[j] / b[j - 1] * c[j - 1];
-			//          
-			alpha[j] -= a[j] / b[j - 1] * alpha[j - 1]; 
-		}
+		// :    ,  a   ;
+		//   -   
+		int Num_Blocks = (Num_Threads > 1 && Num_Segments + 1 >= Parallel_Threshold) ? Num_Threads : 1;
+		Solver.Factorize(a.data(), b.data(), c.data(), Num_Segments + 1, Num_Blocks);
+		System_SMOOTH = SMOOTH;
+
+		//  :       
+		Grid_Step = (Knots[Num_Segments] - Knots[0]) / Num_Segments;
+		Uniform_Grid = Grid_Step > 0.0;
+		for (int i = 1; i < Num_Segments && Uniform_Grid; i++)
+			Uniform_Grid = std::fabs(Knots[i] - (Knots[0] + i * Grid_Step)) < 1e-12 * Grid_Step * Num_Segments;
+	}
 
-		// :  
-		alpha[Num_Segments] /= b[Num_Segments];
-		for (int j = Num_Segments - 1; j >= 0; j--)
-			alpha[j] = (alpha[j] - alpha[j + 1] * c[j]) / b[j];
+	void Smoothing_Spline_1D::Update_Values(const std::vector<double> &F_Value)
+	{
+		Update_Values(F_Value.data(), F_Value.size());
 	}
 
-	void Smoothing_Spline_1D::Get_Value(const Point &P, double * Res)const
+	void Smoothing_Spline_1D::Update_Values(const double *F_Value, std::size_t Count)
 	{
-		
-		double eps = 1e-7;
-	
-		int Num_Segments = Points.size() - 1;
+		if (Knots.size() < 2) throw std::runtime_error("The spline grid is not defined...");
+		if (Count != Knots.size()) throw std::runtime_error("The number of values does not match the grid...");
 
-		double X = P.x();
+		//    :   
+		if (System_SMOOTH != SMOOTH) Assemble_System();
 
-		
-		for (int i = 0; i < Num_Segments; i++)
+		alpha.resize(Knots.size());
+		Solve_Values(F_Value, 1, alpha.data());
+	}
+
+	void Smoothing_Spline_1D::Solve_Values(const double *F_Values, std::size_t Num_Channels, double *Alphas) const
+	{
+		if (Knots.size() < 2) throw std::runtime_error("The spline grid is not defined...");
+		if (System_SMOOTH != SMOOTH) throw std::runtime_error("The system is assembled for another smoothing parameter...");
+
+		int Num_Segments = Knots.size() - 1;
+		std::size_t C = Num_Channels;
+
+		// 
+		Parallel_For(Solver.Get_Num_Blocks(), 0, Num_Segments + 1, [&](long long From, long long To)
 		{
-			if (X > Points[i].x() && X < Points[i + 1].x() ||
-				std::fabs(X - Points[i].x()) < eps ||
-				std::fabs(X - Points[i + 1].x()) < eps)
+			for (long long i = From; i < To; i++)
 			{
-				
-				double h = Points[i + 1].x() - Points[i].x();
-				
-				double Ksi;
-				Transition_To_Master_Element(i, X, Ksi);
-				
-				Res[0] = alpha[i]      * Basis_Function(1, Ksi) +
-						 alpha[i + 1]  * Basis_Function(2, Ksi);
-				Res[1] = (alpha[i]     * Der_Basis_Function(1, Ksi) +
-						  alpha[i + 1] * Der_Basis_Function(2, Ksi)) * 2.0 / h;
-				Res[2] = 0.0;
-				return;
+				const double *F = F_Values + i * C;
+				double *R = Alphas + i * C;
+				for (std::size_t k = 0; k < C; k++) R[k] = i > 0 ? Rhs_a[i] * F_Values[(i - 1) * C + k] : 0.0;
+				for (std::size_t k = 0; k < C; k++) R[k] += Rhs_b[i] * F[k];
+				if (i < Num_Segments)
+					for (std::size_t k = 0; k < C; k++) R[k] += Rhs_c[i] * F[C + k];
 			}
+		});
+
+		//    
+		Solver.Solve(a.data(), b.data(), c.data(), Alphas, C);
+	}
+
+	void Smoothing_Spline_1D::Set_Num_Threads(int Num_Threads, int Parallel_Threshold)
+	{
+		this->Num_Threads = Num_Threads < 1 ? 1 : Num_Threads;
+		this->Parallel_Threshold = Parallel_Threshold;
+		//     
+		if (Knots.size() >= 2) Assemble_System();
+	}
+
+	void Smoothing_Spline_1D::Save(const std::string &File_Name) const
+	{
+		if (Knots.size() < 2 || alpha.size() != Knots.size()) throw std::runtime_error("The spline is not built...");
+		Write_Spline_File(File_Name, SMOOTH, Knots.data(), alpha.data(), Knots.size());
+	}
+
+	void Smoothing_Spline_1D::Load(const std::string &File_Name)
+	{
+		Read_Spline_File(File_Name, SMOOTH, Knots, alpha);
+		Assemble_System();
+	}
+
+	int Smoothing_Spline_1D::Find_Segment(const double &X, int Guess) const
+	{
+		return Locate_Segment(Knots.begin(), Knots.end(), X, Guess, Uniform_Grid ? Grid_Step : 0.0);
+	}
+
+	void Smoothing_Spline_1D::Get_Value(const Point &P, double * Res)const
+	{
+		double X = P.x();
+
+		int i = Find_Segment(X);
+		if (i < 0) throw std::runtime_error("The point is not found in the segments...");
+
+		double h = Knots[i + 1] - Knots[i];
+
+		double Ksi;
+		Transition_To_Master_Element(i, X, Ksi);
+
+		Res[0] = alpha[i]      * Basis_Function(1, Ksi) +
+				 alpha[i + 1]  * Basis_Function(2, Ksi);
+		Res[1] = (alpha[i]     * Der_Basis_Function(1, Ksi) +
+				  alpha[i + 1] * Der_Basis_Function(2, Ksi)) * 2.0 / h;
+		Res[2] = 0.0;
+	}
+
+	void Smoothing_Spline_1D::Get_Values(const double *X, std::size_t Count, double *Values, double *Derivatives) const
+	{
+		int i = -1;
+		for (std::size_t k = 0; k < Count; k++)
+		{
+			//     
+			i = Find_Segment(X[k], i);
+			if (i < 0) throw std::runtime_error("The point is not found in the segments...");
+
+			double h = Knots[i + 1] - Knots[i];
+
+			double Ksi;
+			Transition_To_Master_Element(i, X[k], Ksi);
+
+			Values[k] = alpha[i]     * Basis_Function(1, Ksi) +
+						alpha[i + 1] * Basis_Function(2, Ksi);
+			if (Derivatives)
+				Derivatives[k] = (alpha[i]     * Der_Basis_Function(1, Ksi) +
+								  alpha[i + 1] * Der_Basis_Function(2, Ksi)) * 2.0 / h;
 		}
-		throw std::runtime_error("The point is not found in the segments...");
 	}
 }
\ No newline at end of file
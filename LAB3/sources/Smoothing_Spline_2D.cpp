@@ -0,0 +1,15 @@
+#include "Smoothing_Spline_2D.h"
+
+namespace Com_Methods
+{
+
+	Smoothing_Spline_2D::Smoothing_Spline_2D(const double &SMOOTH) : Smoothing_Spline_Grid(2, SMOOTH)
+	{
+	}
+
+	void Smoothing_Spline_2D::Update_Spline(const std::vector<double> &X, const std::vector<double> &Y,
+											const std::vector<double> &F_Value)
+	{
+		Smoothing_Spline_Grid::Update_Spline({ X, Y }, F_Value);
+	}
+}
\ No newline at end of file
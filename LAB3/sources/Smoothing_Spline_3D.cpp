@@ -0,0 +1,15 @@
+#include "Smoothing_Spline_3D.h"
+
+namespace Com_Methods
+{
+
+	Smoothing_Spline_3D::Smoothing_Spline_3D(const double &SMOOTH) : Smoothing_Spline_Grid(3, SMOOTH)
+	{
+	}
+
+	void Smoothing_Spline_3D::Update_Spline(const std::vector<double> &X, const std::vector<double> &Y, const std::vector<double> &Z,
+											const std::vector<double> &F_Value)
+	{
+		Smoothing_Spline_Grid::Update_Spline({ X, Y, Z }, F_Value);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include <stdexcept>
+#include "Smoothing_Spline_Grid.h"
+
+namespace Com_Methods
+{
+
+	Smoothing_Spline_Grid::Smoothing_Spline_Grid(int Dimension, const double &SMOOTH)
+	{
+		if (Dimension < 1 || Dimension > 3) throw std::runtime_error("The grid dimension must be 1, 2 or 3...");
+		this->Dimension = Dimension;
+		this->SMOOTH = SMOOTH;
+		Tolerance = 1e-12;
+		Max_Iterations = 10000;
+		Iterations = 0;
+	}
+
+	void Smoothing_Spline_Grid::Set_Solver_Parameters(double Tolerance, int Max_Iterations)
+	{
+		this->Tolerance = Tolerance;
+		this->Max_Iterations = Max_Iterations;
+	}
+
+	void Smoothing_Spline_Grid::Solve(const std::vector<double> &F_Grid)
+	{
+		std::vector<double> New_alpha;
+		bool Converged;
+		Iterations = System.Solve(SMOOTH, F_Grid, New_alpha, Tolerance, Max_Iterations, Converged);
+		if (!Converged) throw std::runtime_error("The conjugate gradient method did not converge...");
+		alpha.swap(New_alpha);
+	}
+
+	void Smoothing_Spline_Grid::Update_Spline(const std::vector<Point> &Points,
+											  const std::vector<double> &F_Value)
+	{
+		std::vector<std::vector<double>> Axes;
+		std::vector<double> F_Grid;
+		Tensor_Product_System::Grid_From_Points(Points, F_Value, Dimension, Axes, F_Grid);
+		Update_Spline(Axes, F_Grid);
+	}
+
+	void Smoothing_Spline_Grid::Update_Spline(const std::vector<std::vector<double>> &Axes,
+											  const std::vector<double> &F_Value)
+	{
+		if (static_cast<int>(Axes.size()) != Dimension) throw std::runtime_error("The number of axes does not match the dimension...");
+		alpha.clear();
+		System.Build(Axes);
+		Solve(F_Value);
+	}
+
+	void Smoothing_Spline_Grid::Get_Value(const Point &P, double *Res) const
+	{
+		double Gradient[4] = { 0.0, 0.0, 0.0, 0.0 };
+		Get_Gradient(P, Gradient);
+		Res[0] = Gradient[0];
+		Res[1] = Gradient[1];
+		Res[2] = Gradient[2];
+	}
+
+	void Smoothing_Spline_Grid::Get_Gradient(const Point &P, double *Res) const
+	{
+		if (alpha.empty()) throw std::runtime_error("The spline is not constructed...");
+
+		double Coordinate[3] = { P.x(), P.y(), P.z() };
+		std::size_t Node = 0, Shift[3], Stride = 1;
+
+		//значения и производные одномерных базисных функций по осям
+		double f[3][2], df[3][2];
+		for (int d = 0; d < Dimension; d++)
+		{
+			const std::vector<double> &Axis = System.Get_Axis(d);
+			int i = Tensor_Product_System::Find_Segment(Axis, Coordinate[d]);
+			if (i < 0) throw std::runtime_error("The point is not found in the cells...");
+
+			double h = Axis[i + 1] - Axis[i];
+			//переход на мастер-элемент [-1, 1]
+			double Ksi = 2.0 * (Coordinate[d] - Axis[i]) / h - 1.0;
+			f[d][0] = 0.5 * (1 - Ksi); f[d][1] = 0.5 * (1 + Ksi);
+			df[d][0] = -1.0 / h;       df[d][1] = 1.0 / h;
+
+			Shift[d] = Stride;
+			Node += i * Stride;
+			Stride *= Axis.size();
+		}
+
+		for (int d = 0; d <= Dimension; d++) Res[d] = 0.0;
+		for (int c = 0; c < (1 << Dimension); c++)
+		{
+			std::size_t Corner = Node;
+			for (int d = 0; d < Dimension; d++) Corner += ((c >> d) & 1) * Shift[d];
+			double a = alpha[Corner];
+
+			//Res[0] - произведение функций по всем осям, Res[1 + d] - с производной по оси d
+			for (int r = 0; r <= Dimension; r++)
+			{
+				double Term = a;
+				for (int d = 0; d < Dimension; d++)
+				{
+					int b = (c >> d) & 1;
+					Term *= (r == d + 1) ? df[d][b] : f[d][b];
+				}
+				Res[r] += Term;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+#include "Spline_File.h"
+
+namespace Com_Methods
+{
+
+	void Write_Spline_File(const std::string &File_Name, double SMOOTH,
+						   const double *Knots, const double *alpha, std::size_t Count)
+	{
+		Spline_File_Header Header;
+		std::memcpy(Header.Magic, "SSPL", 4);
+		Header.Version = Spline_File_Version;
+		Header.Byte_Order = Spline_File_Byte_Order;
+		Header.Basis_Order = 1;
+		Header.Count = Count;
+		Header.SMOOTH = SMOOTH;
+
+		std::ofstream File(File_Name, std::ios::binary | std::ios::trunc);
+		if (!File) throw std::runtime_error("The spline file cannot be created...");
+		File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+		File.write(reinterpret_cast<const char*>(Knots), Count * sizeof(double));
+		File.write(reinterpret_cast<const char*>(alpha), Count * sizeof(double));
+		if (!File) throw std::runtime_error("Error writing the spline file...");
+	}
+
+	void Check_Spline_File_Header(const Spline_File_Header &Header, std::uint64_t File_Size)
+	{
+		if (File_Size < sizeof(Header) || std::memcmp(Header.Magic, "SSPL", 4) != 0)
+			throw std::runtime_error("The file is not a spline file...");
+		if (Header.Byte_Order != Spline_File_Byte_Order)
+			throw std::runtime_error("The spline file has a different byte order...");
+		if (Header.Version != Spline_File_Version || Header.Basis_Order != 1)
+			throw std::runtime_error("Unsupported spline file version...");
+		if (Header.Count < 2 || Header.Count > (File_Size - sizeof(Header)) / (2 * sizeof(double)) ||
+			File_Size != sizeof(Header) + 2 * Header.Count * sizeof(double))
+			throw std::runtime_error("The spline file is damaged...");
+	}
+
+	void Read_Spline_File(const std::string &File_Name, double &SMOOTH,
+						  std::vector<double> &Knots, std::vector<double> &alpha)
+	{
+		std::ifstream File(File_Name, std::ios::binary | std::ios::ate);
+		if (!File) throw std::runtime_error("The spline file cannot be opened...");
+		std::uint64_t File_Size = static_cast<std::uint64_t>(File.tellg());
+		File.seekg(0);
+
+		Spline_File_Header Header;
+		if (File_Size >= sizeof(Header)) File.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+		else std::memset(&Header, 0, sizeof(Header));
+		Check_Spline_File_Header(Header, File_Size);
+
+		SMOOTH = Header.SMOOTH;
+		Knots.resize(Header.Count);
+		alpha.resize(Header.Count);
+		File.read(reinterpret_cast<char*>(Knots.data()), Header.Count * sizeof(double));
+		File.read(reinterpret_cast<char*>(alpha.data()), Header.Count * sizeof(double));
+		if (!File) throw std::runtime_error("Error reading the spline file...");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include "Streaming_Smoothing_Spline_1D.h"
+#include "Segment_Search.h"
+
+namespace Com_Methods
+{
+
+	Streaming_Smoothing_Spline_1D::Streaming_Smoothing_Spline_1D(std::size_t Window, const double &SMOOTH)
+	{
+		if (Window < 2) throw std::runtime_error("The window must contain at least two points...");
+		this->Window = Window;
+		this->SMOOTH = SMOOTH;
+		Tolerance = 1e-15;
+	}
+
+	double Streaming_Smoothing_Spline_1D::Diagonal(std::size_t i) const
+	{
+		double W = 1.0, d = 0.0;
+		//вклады сегментов [i - 1, i] и [i, i + 1]
+		if (i > 0)            d += (1.0 - SMOOTH) * W + SMOOTH / (X[i] - X[i - 1]);
+		if (i + 1 < X.size()) d += (1.0 - SMOOTH) * W + SMOOTH / (X[i + 1] - X[i]);
+		return d;
+	}
+
+	double Streaming_Smoothing_Spline_1D::Right_Part(std::size_t i) const
+	{
+		double W = 1.0;
+		int Num_Segments = (i > 0) + (i + 1 < X.size());
+		return (1.0 - SMOOTH) * W * Num_Segments * F[i];
+	}
+
+	double Streaming_Smoothing_Spline_1D::Upper(std::size_t i) const
+	{
+		return -SMOOTH / (X[i + 1] - X[i]);
+	}
+
+	void Streaming_Smoothing_Spline_1D::Forward_Row(std::size_t i, double &Piv, double &Rhs) const
+	{
+		Piv = Diagonal(i);
+		Rhs = Right_Part(i);
+		if (i > 0)
+		{
+			double e = Upper(i - 1), m = e / Pivot[i - 1];
+			Piv -= m * e;
+			Rhs -= m * G[i - 1];
+		}
+	}
+
+	bool Streaming_Smoothing_Spline_1D::Converged(double New_Value, double Old_Value, double Scale) const
+	{
+		return std::fabs(New_Value - Old_Value) <= Tolerance * (std::fabs(New_Value) + Scale);
+	}
+
+	void Streaming_Smoothing_Spline_1D::Push_Scale(double F_Value)
+	{
+		double Scale = std::fabs(F_Value);
+		while (!Scale_Window.empty() && Scale_Window.back() < Scale) Scale_Window.pop_back();
+		Scale_Window.push_back(Scale);
+	}
+
+	void Streaming_Smoothing_Spline_1D::Back_Substitution(std::size_t From)
+	{
+		std::size_t n = X.size();
+		for (std::size_t i = From + 1; i-- > 0; )
+			alpha[i] = (i + 1 < n) ? (G[i] - Upper(i) * alpha[i + 1]) / Pivot[i] : G[i] / Pivot[i];
+	}
+
+	void Streaming_Smoothing_Spline_1D::Append(double X_New, double F_Value)
+	{
+		if (!X.empty() && !(X_New > X.back()))
+			throw std::runtime_error("The stream points must be in ascending order...");
+
+		X.push_back(X_New);
+		F.push_back(F_Value);
+		Push_Scale(F_Value);
+
+		std::size_t n = X.size();
+		if (n == 1)
+		{
+			Pivot.push_back(0.0); G.push_back(0.0); alpha.push_back(F_Value);
+			return;
+		}
+
+		//новый сегмент меняет бывшую последнюю строку: пересчёт прямого хода в двух строках
+		Pivot.push_back(0.0); G.push_back(0.0); alpha.push_back(0.0);
+		for (std::size_t i = n - 2; i < n; i++) Forward_Row(i, Pivot[i], G[i]);
+
+		//обратный ход от нового узла: старые коэффициенты меняются, пока не затухнет возмущение;
+		//при втором узле окна пересчитывается вся СЛАУ
+		for (std::size_t i = n; i-- > 0; )
+		{
+			double Old_Value = alpha[i];
+			alpha[i] = (i + 1 < n) ? (G[i] - Upper(i) * alpha[i + 1]) / Pivot[i] : G[i] / Pivot[i];
+			if (i + 2 < n && Converged(alpha[i], Old_Value, Value_Scale())) break;
+		}
+
+		if (n > Window) Drop_Oldest();
+	}
+
+	void Streaming_Smoothing_Spline_1D::Drop_Oldest()
+	{
+		if (!Scale_Window.empty() && Scale_Window.front() == std::fabs(F.front())) Scale_Window.pop_front();
+		X.pop_front(); F.pop_front();
+		Pivot.pop_front(); G.pop_front(); alpha.pop_front();
+
+		//первая строка потеряла сегмент: прямой ход пересчитывается от начала окна,
+		//пока ведущие элементы и правые части не совпадут с прежними
+		std::size_t n = X.size(), Last = 0;
+		for (std::size_t i = 0; i < n; i++)
+		{
+			double Piv, Rhs;
+			Forward_Row(i, Piv, Rhs);
+			bool Stable = Converged(Piv, Pivot[i], 0.0) && Converged(Rhs, G[i], Value_Scale());
+			Pivot[i] = Piv;
+			G[i] = Rhs;
+			Last = i;
+			if (i > 0 && Stable) break;
+		}
+
+		//коэффициенты после строки Last не изменились, до неё - пересчитываются все
+		Back_Substitution(Last);
+	}
+
+	void Streaming_Smoothing_Spline_1D::Update_Spline(const std::vector<Point> &Points,
+													  const std::vector<double> &F_Value)
+	{
+		if (F_Value.size() != Points.size()) throw std::runtime_error("The number of values does not match the grid...");
+
+		X.clear(); F.clear(); Pivot.clear(); G.clear(); alpha.clear();
+		Scale_Window.clear();
+
+		std::size_t First = Points.size() > Window ? Points.size() - Window : 0;
+		for (std::size_t i = First; i < Points.size(); i++)
+		{
+			if (i > First && !(Points[i].x() > Points[i - 1].x()))
+				throw std::runtime_error("The stream points must be in ascending order...");
+			X.push_back(Points[i].x());
+			F.push_back(F_Value[i]);
+			Push_Scale(F_Value[i]);
+		}
+
+		//полная прогонка по окну
+		std::size_t n = X.size();
+		Pivot.resize(n); G.resize(n); alpha.resize(n);
+		if (n < 2) { if (n == 1) alpha[0] = F[0]; return; }
+		for (std::size_t i = 0; i < n; i++) Forward_Row(i, Pivot[i], G[i]);
+		alpha[n - 1] = G[n - 1] / Pivot[n - 1];
+		for (std::size_t i = n - 1; i-- > 0; ) alpha[i] = (G[i] - Upper(i) * alpha[i + 1]) / Pivot[i];
+	}
+
+	void Streaming_Smoothing_Spline_1D::Get_Value(const Point &P, double *Res) const
+	{
+		double X_P = P.x();
+
+		int i = Locate_Segment(X.begin(), X.end(), X_P);
+		if (i < 0) throw std::runtime_error("The point is not found in the segments...");
+
+		double h = X[i + 1] - X[i];
+		double Ksi = 2.0 * (X_P - X[i]) / h - 1.0;
+
+		Res[0] = alpha[i] * 0.5 * (1 - Ksi) + alpha[i + 1] * 0.5 * (1 + Ksi);
+		Res[1] = (alpha[i + 1] - alpha[i]) / h;
+		Res[2] = 0.0;
+	}
+}
\ No newline at end of file
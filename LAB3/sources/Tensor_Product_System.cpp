@@ -0,0 +1,240 @@
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include "Tensor_Product_System.h"
+#include "Segment_Search.h"
+
+namespace Com_Methods
+{
+
+	Tensor_Product_System::Tensor_Product_System()
+	{
+		Size = 0;
+	}
+
+	void Tensor_Product_System::Build(const std::vector<std::vector<double>> &Axes)
+	{
+		int Dimension = Axes.size();
+		this->Axes = Axes;
+		Mass_b.resize(Dimension); Mass_c.resize(Dimension);
+		Stiff_b.resize(Dimension); Stiff_c.resize(Dimension);
+		Count.resize(Dimension);
+		Stride.resize(Dimension);
+
+		Size = 1;
+		for (int d = 0; d < Dimension; d++)
+		{
+			const std::vector<double> &X = Axes[d];
+			int n = X.size();
+			if (n < 2) throw std::runtime_error("The grid must contain at least two nodes along each axis...");
+
+			Stride[d] = Size;
+			Size *= n;
+
+			Mass_b[d].assign(n, 0.0); Mass_c[d].assign(n, 0.0);
+			Stiff_b[d].assign(n, 0.0); Stiff_c[d].assign(n, 0.0);
+			Count[d].assign(n, 0.0);
+
+			//сборка одномерных матриц по сегментам
+			for (int i = 0; i < n - 1; i++)
+			{
+				double h = X[i + 1] - X[i];
+				if (!(h > 0.0)) throw std::runtime_error("The grid nodes must be in ascending order...");
+
+				Mass_b[d][i]     += h / 3.0;
+				Mass_b[d][i + 1] += h / 3.0;
+				Mass_c[d][i]     += h / 6.0;
+
+				Stiff_b[d][i]     += 1.0 / h;
+				Stiff_b[d][i + 1] += 1.0 / h;
+				Stiff_c[d][i]     -= 1.0 / h;
+
+				Count[d][i]     += 1.0;
+				Count[d][i + 1] += 1.0;
+			}
+		}
+	}
+
+	double Tensor_Product_System::Data_Weight(std::size_t Node) const
+	{
+		double W = 1.0;
+		for (std::size_t d = 0; d < Axes.size(); d++)
+			W *= Count[d][(Node / Stride[d]) % Axes[d].size()];
+		return W;
+	}
+
+	void Tensor_Product_System::Apply_Axis(int Axis, const std::vector<double> &b, const std::vector<double> &c,
+										   const double *In, double *Out) const
+	{
+		std::size_t s = Stride[Axis], n = Axes[Axis].size();
+
+		//линии вдоль оси: внутренний цикл идёт по соседним в памяти линиям
+		for (std::size_t Offset = 0; Offset < Size; Offset += s * n)
+		{
+			for (std::size_t i = 0; i < n; i++)
+			{
+				const double *U = In + Offset + i * s;
+				double *R = Out + Offset + i * s;
+				for (std::size_t k = 0; k < s; k++) R[k] = b[i] * U[k];
+				if (i > 0)
+				{
+					const double *U_Prev = U - s;
+					for (std::size_t k = 0; k < s; k++) R[k] += c[i - 1] * U_Prev[k];
+				}
+				if (i + 1 < n)
+				{
+					const double *U_Next = U + s;
+					for (std::size_t k = 0; k < s; k++) R[k] += c[i] * U_Next[k];
+				}
+			}
+		}
+	}
+
+	void Tensor_Product_System::Apply(double p, const std::vector<double> &Weight, const double *U, double *Res,
+									  std::vector<double> &Buffer_1, std::vector<double> &Buffer_2) const
+	{
+		int Dimension = Axes.size();
+
+		for (std::size_t k = 0; k < Size; k++) Res[k] = (1.0 - p) * Weight[k] * U[k];
+
+		//слагаемое с производной по оси d: K по оси d, M по остальным осям
+		for (int d = 0; d < Dimension; d++)
+		{
+			const double *In = U;
+			for (int a = 0; a < Dimension; a++)
+			{
+				double *Out = (In == Buffer_1.data()) ? Buffer_2.data() : Buffer_1.data();
+				if (a == d) Apply_Axis(a, Stiff_b[a], Stiff_c[a], In, Out);
+				else        Apply_Axis(a, Mass_b[a], Mass_c[a], In, Out);
+				In = Out;
+			}
+			for (std::size_t k = 0; k < Size; k++) Res[k] += p * In[k];
+		}
+	}
+
+	int Tensor_Product_System::Solve(double p, const std::vector<double> &F, std::vector<double> &alpha,
+									 double Tolerance, int Max_Iterations, bool &Converged) const
+	{
+		if (F.size() != Size) throw std::runtime_error("The number of values does not match the grid...");
+		int Dimension = Axes.size();
+
+		std::vector<double> Buffer_1(Size), Buffer_2(Size);
+		std::vector<double> r(Size), z(Size), q(Size), Aq(Size), Diagonal(Size), Weight(Size);
+
+		//диагональ W и диагональ матрицы для предобусловливателя
+		for (std::size_t k = 0; k < Size; k++)
+		{
+			Weight[k] = Data_Weight(k);
+			double S = 0.0;
+			for (int d = 0; d < Dimension; d++)
+			{
+				double Term = 1.0;
+				for (int a = 0; a < Dimension; a++)
+				{
+					std::size_t i = (k / Stride[a]) % Axes[a].size();
+					Term *= (a == d) ? Stiff_b[a][i] : Mass_b[a][i];
+				}
+				S += Term;
+			}
+			Diagonal[k] = (1.0 - p) * Weight[k] + p * S;
+		}
+
+		//начальное приближение - сами значения
+		alpha = F;
+		Apply(p, Weight, alpha.data(), Aq.data(), Buffer_1, Buffer_2);
+		double Rhs_Norm = 0.0;
+		for (std::size_t k = 0; k < Size; k++)
+		{
+			double Rhs = (1.0 - p) * Weight[k] * F[k];
+			r[k] = Rhs - Aq[k];
+			Rhs_Norm += Rhs * Rhs;
+		}
+		Rhs_Norm = std::sqrt(Rhs_Norm);
+		if (Rhs_Norm == 0.0) Rhs_Norm = 1.0;
+
+		double rz = 0.0;
+		for (std::size_t k = 0; k < Size; k++)
+		{
+			z[k] = r[k] / Diagonal[k];
+			q[k] = z[k];
+			rz += r[k] * z[k];
+		}
+
+		//метод сопряжённых градиентов
+		//невязка проверяется и после последней итерации
+		int Iteration = 0;
+		Converged = false;
+		for (;; Iteration++)
+		{
+			double r_Norm = 0.0;
+			for (std::size_t k = 0; k < Size; k++) r_Norm += r[k] * r[k];
+			if (std::sqrt(r_Norm) <= Tolerance * Rhs_Norm)
+			{
+				Converged = true;
+				break;
+			}
+			if (Iteration >= Max_Iterations) break;
+
+			Apply(p, Weight, q.data(), Aq.data(), Buffer_1, Buffer_2);
+			double qAq = 0.0;
+			for (std::size_t k = 0; k < Size; k++) qAq += q[k] * Aq[k];
+			double Step = rz / qAq;
+
+			double rz_New = 0.0;
+			for (std::size_t k = 0; k < Size; k++)
+			{
+				alpha[k] += Step * q[k];
+				r[k] -= Step * Aq[k];
+				z[k] = r[k] / Diagonal[k];
+				rz_New += r[k] * z[k];
+			}
+			double Beta = rz_New / rz;
+			rz = rz_New;
+			for (std::size_t k = 0; k < Size; k++) q[k] = z[k] + Beta * q[k];
+		}
+		return Iteration;
+	}
+
+	int Tensor_Product_System::Find_Segment(const std::vector<double> &Axis, double X)
+	{
+		return Locate_Segment(Axis.begin(), Axis.end(), X);
+	}
+
+	void Tensor_Product_System::Grid_From_Points(const std::vector<Point> &Points, const std::vector<double> &F_Value,
+												 int Dimension, std::vector<std::vector<double>> &Axes,
+												 std::vector<double> &F_Grid)
+	{
+		if (F_Value.size() != Points.size()) throw std::runtime_error("The number of values does not match the grid...");
+
+		auto Coordinate = [](const Point &P, int d) { return d == 0 ? P.x() : (d == 1 ? P.y() : P.z()); };
+
+		//узлы по осям - различные значения координат
+		Axes.assign(Dimension, std::vector<double>());
+		std::size_t Size = 1;
+		for (int d = 0; d < Dimension; d++)
+		{
+			for (const auto &P : Points) Axes[d].push_back(Coordinate(P, d));
+			std::sort(Axes[d].begin(), Axes[d].end());
+			Axes[d].erase(std::unique(Axes[d].begin(), Axes[d].end()), Axes[d].end());
+			Size *= Axes[d].size();
+		}
+		if (Size != Points.size()) throw std::runtime_error("The points do not form a structured grid...");
+
+		//значения в порядке узлов сетки
+		F_Grid.assign(Size, 0.0);
+		std::vector<char> Filled(Size, 0);
+		for (std::size_t k = 0; k < Points.size(); k++)
+		{
+			std::size_t Node = 0, Stride = 1;
+			for (int d = 0; d < Dimension; d++)
+			{
+				std::size_t i = std::lower_bound(Axes[d].begin(), Axes[d].end(), Coordinate(Points[k], d)) - Axes[d].begin();
+				Node += i * Stride;
+				Stride *= Axes[d].size();
+			}
+			if (Filled[Node]) throw std::runtime_error("The points do not form a structured grid...");
+			Filled[Node] = 1;
+			F_Grid[Node] = F_Value[k];
+		}
+	}
+}
\ No newline at end of file
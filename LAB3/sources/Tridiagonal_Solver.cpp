@@ -0,0 +1,182 @@
+#include "Tridiagonal_Solver.h"
+#include "Parallel_For.h"
+
+namespace Com_Methods
+{
+
+	Tridiagonal_Solver::Tridiagonal_Solver()
+	{
+		N = 0;
+	}
+
+	void Tridiagonal_Solver::Block_Rows(int k, long long &From, long long &To) const
+	{
+		int Num_Blocks = Get_Num_Blocks();
+		From = Start[k];
+		To = (k < Num_Blocks - 1) ? Start[k + 1] - 1 : N;
+	}
+
+	void Tridiagonal_Solver::Factorize(double *a, double *b, const double *c, int n, int Num_Blocks)
+	{
+		N = n;
+		//в каждом блоке должно быть не менее двух строк
+		if (Num_Blocks < 1 || n < 3 * Num_Blocks) Num_Blocks = 1;
+
+		Start.resize(Num_Blocks + 1);
+		for (int k = 0; k <= Num_Blocks; k++) Start[k] = static_cast<long long>(n) * k / Num_Blocks;
+
+		if (Num_Blocks == 1)
+		{
+			V.clear(); W.clear();
+			Red_a.clear(); Red_b.clear(); Red_c.clear();
+
+			//прямой ход прогонки по матрице
+			for (int j = 1; j < n; j++)
+			{
+				a[j] /= b[j - 1];
+				b[j] -= a[j] * c[j - 1];
+			}
+			return;
+		}
+
+		V.assign(n, 0.0); W.assign(n, 0.0);
+
+		//разложение блоков и вычисление спайков
+		Parallel_For(Num_Blocks, 0, Num_Blocks, [&](long long Block_From, long long Block_To)
+		{
+			for (long long k = Block_From; k < Block_To; k++)
+			{
+				long long s, e;
+				Block_Rows(static_cast<int>(k), s, e);
+
+				//прямой ход без учёта связей с разделителями: a[s] и c[e - 1] остаются исходными
+				for (long long j = s + 1; j < e; j++)
+				{
+					a[j] /= b[j - 1];
+					b[j] -= a[j] * c[j - 1];
+				}
+
+				//спайк V: правая часть a[s] в первой строке блока (связь с левым разделителем)
+				if (k > 0)
+				{
+					V[s] = a[s];
+					for (long long j = s + 1; j < e; j++) V[j] = -a[j] * V[j - 1];
+					V[e - 1] /= b[e - 1];
+					for (long long j = e - 2; j >= s; j--) V[j] = (V[j] - c[j] * V[j + 1]) / b[j];
+				}
+
+				//спайк W: правая часть c[e - 1] в последней строке блока (связь с правым разделителем)
+				if (k < Num_Blocks - 1)
+				{
+					W[e - 1] = c[e - 1] / b[e - 1];
+					for (long long j = e - 2; j >= s; j--) W[j] = -c[j] * W[j + 1] / b[j];
+				}
+			}
+		});
+
+		//редуцированная СЛАУ для разделителей r = Start[k + 1] - 1
+		int M = Num_Blocks - 1;
+		Red_a.assign(M, 0.0); Red_b.assign(M, 0.0); Red_c.assign(M, 0.0);
+		for (int k = 0; k < M; k++)
+		{
+			long long r = Start[k + 1] - 1;
+			Red_a[k] = -a[r] * V[r - 1];
+			Red_b[k] = b[r] - a[r] * W[r - 1] - c[r] * V[r + 1];
+			Red_c[k] = -c[r] * W[r + 1];
+		}
+		for (int k = 1; k < M; k++)
+		{
+			Red_a[k] /= Red_b[k - 1];
+			Red_b[k] -= Red_a[k] * Red_c[k - 1];
+		}
+	}
+
+	void Tridiagonal_Solver::Solve(const double *a, const double *b, const double *c, double *R, std::size_t Num_Channels) const
+	{
+		std::size_t C = Num_Channels;
+		int Num_Blocks = Get_Num_Blocks();
+
+		//прямой и обратный ход прогонки в строках [s, e)
+		auto Sweep = [&](long long s, long long e)
+		{
+			for (long long j = s + 1; j < e; j++)
+			{
+				double *Row = R + j * C;
+				const double *Row_Prev = R + (j - 1) * C;
+				for (std::size_t k = 0; k < C; k++) Row[k] -= a[j] * Row_Prev[k];
+			}
+			for (std::size_t k = 0; k < C; k++) R[(e - 1) * C + k] /= b[e - 1];
+			for (long long j = e - 2; j >= s; j--)
+			{
+				double *Row = R + j * C;
+				const double *Row_Next = R + (j + 1) * C;
+				for (std::size_t k = 0; k < C; k++) Row[k] = (Row[k] - Row_Next[k] * c[j]) / b[j];
+			}
+		};
+
+		if (Num_Blocks <= 1)
+		{
+			if (N > 0) Sweep(0, N);
+			return;
+		}
+
+		//решения блоков без учёта разделителей
+		Parallel_For(Num_Blocks, 0, Num_Blocks, [&](long long Block_From, long long Block_To)
+		{
+			for (long long k = Block_From; k < Block_To; k++)
+			{
+				long long s, e;
+				Block_Rows(static_cast<int>(k), s, e);
+				Sweep(s, e);
+			}
+		});
+
+		//значения в разделителях: прогонка по редуцированной СЛАУ
+		int M = Num_Blocks - 1;
+		for (int k = 0; k < M; k++)
+		{
+			long long r = Start[k + 1] - 1;
+			double *Row = R + r * C;
+			const double *Row_Prev = R + (r - 1) * C, *Row_Next = R + (r + 1) * C;
+			for (std::size_t l = 0; l < C; l++) Row[l] -= a[r] * Row_Prev[l] + c[r] * Row_Next[l];
+			if (k > 0)
+			{
+				const double *Sep_Prev = R + (Start[k] - 1) * C;
+				for (std::size_t l = 0; l < C; l++) Row[l] -= Red_a[k] * Sep_Prev[l];
+			}
+		}
+		for (int k = M - 1; k >= 0; k--)
+		{
+			double *Row = R + (Start[k + 1] - 1) * C;
+			if (k < M - 1)
+			{
+				const double *Sep_Next = R + (Start[k + 2] - 1) * C;
+				for (std::size_t l = 0; l < C; l++) Row[l] = (Row[l] - Red_c[k] * Sep_Next[l]) / Red_b[k];
+			}
+			else
+				for (std::size_t l = 0; l < C; l++) Row[l] /= Red_b[k];
+		}
+
+		//поправка блоков на значения в разделителях: x = y - V * x_left - W * x_right
+		Parallel_For(Num_Blocks, 0, Num_Blocks, [&](long long Block_From, long long Block_To)
+		{
+			for (long long k = Block_From; k < Block_To; k++)
+			{
+				long long s, e;
+				Block_Rows(static_cast<int>(k), s, e);
+				if (k > 0)
+				{
+					const double *Left = R + (s - 1) * C;
+					for (long long j = s; j < e; j++)
+						for (std::size_t l = 0; l < C; l++) R[j * C + l] -= V[j] * Left[l];
+				}
+				if (k < Num_Blocks - 1)
+				{
+					const double *Right = R + e * C;
+					for (long long j = s; j < e; j++)
+						for (std::size_t l = 0; l < C; l++) R[j * C + l] -= W[j] * Right[l];
+				}
+			}
+		});
+	}
+}
\ No newline at end of file
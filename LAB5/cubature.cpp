@@ -0,0 +1,95 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include "cubature.h"
+#include "gauss_rules.h"
+
+SparseGridCubature::SparseGridCubature(int dimension) : dimension(dimension) {
+    if (dimension < 1) throw std::invalid_argument("SparseGridCubature: dimension must be positive");
+}
+
+const SparseGridCubature::Grid& SparseGridCubature::grid(int level) {
+    if (level < 1) throw std::invalid_argument("SparseGridCubature: level must be positive");
+    if (static_cast<int>(grids.size()) >= level) return grids[level - 1];
+
+    while (static_cast<int>(grids.size()) < level) {
+        int L = static_cast<int>(grids.size()) + 1, d = dimension;
+        int q = L + d - 1;
+
+        // биномиальные коэффициенты C(d - 1, k), k = 0..L - 1
+        std::vector<double> binomial(L, 1.0);
+        for (int k = 1; k < L; ++k) binomial[k] = binomial[k - 1] * (d - k) / k;
+
+        // одинаковые узлы разных тензорных произведений суммируются в одну точку; веса слагаемых
+        // велики и разных знаков, поэтому сумма компенсированная
+        std::map<std::vector<double>, quadrature_detail::NeumaierSum> points;
+        std::vector<int> l(d, 1);
+        std::vector<double> x(d);
+        int sum = d;
+        while (true) {
+            if (sum >= L && sum <= q && q - sum <= d - 1) {
+                double coefficient = ((q - sum) % 2 == 0 ? 1.0 : -1.0) * binomial[q - sum];
+                // перебор узлов тензорного произведения правил с 2 l_j - 1 точками
+                std::vector<int> index(d, 0);
+                while (true) {
+                    double weight = coefficient;
+                    for (int j = 0; j < d; ++j) {
+                        const GaussTable& table = gaussTable(2 * l[j] - 1);
+                        x[j] = table.nodes[index[j]];
+                        weight *= table.weights[index[j]];
+                    }
+                    points[x].add(weight);
+
+                    int j = 0;
+                    while (j < d && ++index[j] == 2 * l[j] - 1) index[j++] = 0;
+                    if (j == d) break;
+                }
+            }
+
+            // следующий мультииндекс l с |l| <= q (l_j >= 1)
+            int j = 0;
+            while (j < d) {
+                if (sum < q) {
+                    ++l[j];
+                    ++sum;
+                    break;
+                }
+                sum -= l[j] - 1;
+                l[j++] = 1;
+            }
+            if (j == d) break;
+        }
+
+        Grid g;
+        g.nodes.reserve(points.size() * d);
+        g.weights.reserve(points.size());
+        for (const auto& point : points) {
+            double weight = point.second.value();
+            if (weight == 0.0) continue;
+            g.nodes.insert(g.nodes.end(), point.first.begin(), point.first.end());
+            g.weights.push_back(weight);
+        }
+        grids.push_back(std::move(g));
+    }
+    return grids[level - 1];
+}
+
+QuasiMonteCarloCubature::QuasiMonteCarloCubature(int dimension, int shifts, std::uint64_t seed)
+    : dimension(dimension), shifts(shifts), alpha(dimension), shift(static_cast<std::size_t>(shifts) * dimension) {
+    if (dimension < 1 || shifts < 1) throw std::invalid_argument("QuasiMonteCarloCubature: invalid parameters");
+
+    // phi_d: корень x^(d+1) = x + 1 методом Ньютона
+    long double phi = 2.0L;
+    for (int iteration = 0; iteration < 100; ++iteration) {
+        long double power = std::pow(phi, static_cast<long double>(dimension));
+        phi -= (power * phi - phi - 1.0L) / ((dimension + 1) * power - 1.0L);
+    }
+    long double inverse = 1.0L;
+    for (int j = 0; j < dimension; ++j) {
+        inverse /= phi;
+        alpha[j] = static_cast<std::uint64_t>(std::ldexp(inverse - std::floor(inverse), 64));
+    }
+
+    std::mt19937_64 generator(seed);
+    for (auto& s : shift) s = generator();
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#ifndef CUBATURE_H
+#define CUBATURE_H
+
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include "integral_calculators.h"
+
+// Кубатурные формулы для интегралов по параллелепипеду [a_1, b_1] x ... x [a_d, b_d].
+// Подынтегральная функция - вызываемый объект f(const double* x) -> double, x - d координат точки;
+// f вызывается из нескольких потоков одновременно (numThreads = 0 - по числу ядер).
+// Суммы по узлам компенсированные и складываются в порядке потоков, поэтому результат при заданном
+// числе потоков воспроизводится побитово.
+
+// Разреженная сетка Смоляка (комбинационная формула) из одномерных правил Гаусса-Лежандра
+// с 2l - 1 точками на уровне l (gaussTable):
+//   Q_L = sum_{L <= |l| <= L + d - 1} (-1)^{L + d - 1 - |l|} C(d - 1, L + d - 1 - |l|) Q_{l_1} x ... x Q_{l_d};
+// точна для многочленов полной степени 2L - 1, число узлов растёт как O((2d)^(L-1)) вместо (2L - 1)^d.
+// Совпадающие узлы разных тензорных произведений объединяются.
+class SparseGridCubature {
+public:
+    explicit SparseGridCubature(int dimension);
+
+    // значение формулы уровня level >= 1
+    template <class F>
+    double computeLevel(F f, const std::vector<double>& a, const std::vector<double>& b, int level, int numThreads = 0);
+    // повышение уровня до |Q_L - Q_{L-1}| <= max(absTol, relTol * |Q_L|) или до maxLevel
+    template <class F>
+    IntegrationResult compute(F f, const std::vector<double>& a, const std::vector<double>& b,
+                              double absTol, double relTol, int maxLevel = 6, int numThreads = 0);
+    // число узлов сетки уровня level
+    std::size_t size(int level) { return grid(level).weights.size(); }
+    int getDimension() const { return dimension; }
+
+private:
+    struct Grid {
+        std::vector<double> nodes;   // узлы на [-1, 1]^d подряд по d координат
+        std::vector<double> weights;
+    };
+
+    int dimension;
+    std::vector<Grid> grids;         // grids[level - 1], строятся при первом обращении
+
+    const Grid& grid(int level);
+};
+
+// Рандомизированный квази-Монте-Карло: последовательность Кронекера x_k = {s + k alpha}
+// (бесконечная решётка ранга 1) с alpha_j = {phi_d^-(j+1)}, phi_d - корень x^(d+1) = x + 1
+// (обобщённое золотое сечение), и shifts случайных сдвигов s (Крэнли-Паттерсон). Оценка - среднее
+// по сдвигам, погрешность - стандартная ошибка среднего. Число точек удваивается, при этом
+// уже вычисленные точки последовательности используются повторно. По умолчанию применяется
+// преобразование пекаря t -> 1 - |2t - 1|, ускоряющее сходимость для непериодических функций.
+class QuasiMonteCarloCubature {
+public:
+    QuasiMonteCarloCubature(int dimension, int shifts = 16, std::uint64_t seed = 20240601);
+
+    template <class F>
+    IntegrationResult compute(F f, const std::vector<double>& a, const std::vector<double>& b,
+                              double absTol, double relTol, long long maxPoints = 1 << 22, int numThreads = 0);
+    void setPeriodization(bool baker) { this->baker = baker; }
+    int getDimension() const { return dimension; }
+
+private:
+    int dimension;
+    int shifts;
+    bool baker = true;
+    std::vector<std::uint64_t> alpha;  // alpha_j * 2^64
+    std::vector<std::uint64_t> shift;  // сдвиги s * 2^64, shifts строк по dimension
+};
+
+template <class F>
+double SparseGridCubature::computeLevel(F f, const std::vector<double>& a, const std::vector<double>& b,
+                                        int level, int numThreads) {
+    const Grid& g = grid(level);
+    int d = dimension;
+    double scale = 1.0;
+    for (int j = 0; j < d; ++j) scale *= 0.5 * (b[j] - a[j]);
+
+    long long count = static_cast<long long>(g.weights.size());
+    numThreads = quadrature_detail::threadCount(numThreads, count);
+    std::vector<quadrature_detail::NeumaierSum> partial(numThreads);
+    quadrature_detail::parallelRanges(0, count, numThreads, [&](int t, long long from, long long to) {
+        std::vector<double> x(d);
+        for (long long i = from; i < to; ++i) {
+            const double* node = g.nodes.data() + i * d;
+            for (int j = 0; j < d; ++j) x[j] = a[j] + 0.5 * (node[j] + 1.0) * (b[j] - a[j]);
+            partial[t].add(g.weights[i] * f(static_cast<const double*>(x.data())));
+        }
+    });
+
+    quadrature_detail::NeumaierSum total;
+    for (const auto& p : partial) {
+        total.add(p.sum);
+        total.add(p.compensation);
+    }
+    return scale * total.value();
+}
+
+template <class F>
+IntegrationResult SparseGridCubature::compute(F f, const std::vector<double>& a, const std::vector<double>& b,
+                                              double absTol, double relTol, int maxLevel, int numThreads) {
+    IntegrationResult result;
+    double previous = computeLevel(f, a, b, 1, numThreads);
+    result.evaluations = static_cast<long long>(size(1));
+    result.value = previous;
+    result.error = std::abs(previous);
+
+    for (int level = 2; level <= maxLevel; ++level) {
+        result.value = computeLevel(f, a, b, level, numThreads);
+        result.evaluations += static_cast<long long>(size(level));
+        result.error = std::abs(result.value - previous);
+        if (result.error <= std::max(absTol, relTol * std::abs(result.value))) {
+            result.converged = true;
+            break;
+        }
+        previous = result.value;
+    }
+    return result;
+}
+
+template <class F>
+IntegrationResult QuasiMonteCarloCubature::compute(F f, const std::vector<double>& a, const std::vector<double>& b,
+                                                   double absTol, double relTol, long long maxPoints, int numThreads) {
+    IntegrationResult result;
+    int d = dimension;
+    double volume = 1.0;
+    for (int j = 0; j < d; ++j) volume *= b[j] - a[j];
+
+    // суммы значений по каждому сдвигу; точки [done, n) добавляются при удвоении n
+    std::vector<quadrature_detail::NeumaierSum> sums(shifts);
+    long long done = 0;
+    for (long long n = std::min<long long>(1024, maxPoints); ; n = std::min(2 * n, maxPoints)) {
+        for (int s = 0; s < shifts; ++s) {
+            int threads = quadrature_detail::threadCount(numThreads, n - done);
+            std::vector<quadrature_detail::NeumaierSum> partial(threads);
+            quadrature_detail::parallelRanges(done, n, threads, [&](int t, long long from, long long to) {
+                std::vector<double> x(d);
+                const std::uint64_t* s0 = shift.data() + static_cast<std::size_t>(s) * d;
+                for (long long k = from; k < to; ++k) {
+                    for (int j = 0; j < d; ++j) {
+                        // {s + k alpha} в арифметике по модулю 2^64 без потери точности при больших k
+                        std::uint64_t point = s0[j] + static_cast<std::uint64_t>(k) * alpha[j];
+                        double u = std::ldexp(static_cast<double>(point >> 11), -53);
+                        if (baker) u = 1.0 - std::abs(2.0 * u - 1.0);
+                        x[j] = a[j] + u * (b[j] - a[j]);
+                    }
+                    partial[t].add(f(static_cast<const double*>(x.data())));
+                }
+            });
+            for (const auto& p : partial) {
+                sums[s].add(p.sum);
+                sums[s].add(p.compensation);
+            }
+        }
+        done = n;
+
+        double mean = 0.0, variance = 0.0;
+        for (const auto& sum : sums) mean += volume * sum.value() / n;
+        mean /= shifts;
+        for (const auto& sum : sums) {
+            double deviation = volume * sum.value() / n - mean;
+            variance += deviation * deviation;
+        }
+        variance /= std::max(1, shifts - 1);
+
+        result.value = mean;
+        result.error = std::sqrt(variance / shifts);
+        result.evaluations = n * shifts;
+        result.converged = shifts > 1 && result.error <= std::max(absTol, relTol * std::abs(mean));
+        if (result.converged || n >= maxPoints) break;
+    }
+    return result;
+}
+
+#endif
\ No newline at end of file
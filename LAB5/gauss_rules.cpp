@@ -0,0 +1,23 @@
+#include <map>
+#include <mutex>
+#include <utility>
+#include <stdexcept>
+#include "gauss_rules.h"
+
+const GaussTable& gaussTable(int n, bool lobatto) {
+    if (n < (lobatto ? 2 : 1)) throw std::invalid_argument("gaussTable: too few points");
+
+    static std::map<std::pair<int, bool>, GaussTable> cache;
+    static std::mutex cacheMutex;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    auto it = cache.find({ n, lobatto });
+    if (it != cache.end()) return it->second;
+
+    GaussTable table;
+    table.nodes.resize(n);
+    table.weights.resize(n);
+    if (lobatto) gauss_detail::gaussLobatto(n, table.nodes.data(), table.weights.data());
+    else gauss_detail::gaussLegendre(n, table.nodes.data(), table.weights.data());
+    return cache.emplace(std::make_pair(n, lobatto), std::move(table)).first->second;
+}
\ No newline at end of file
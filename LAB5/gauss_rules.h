@@ -0,0 +1,221 @@
+#ifndef GAUSS_RULES_H
+#define GAUSS_RULES_H
+
+#include <vector>
+#include "integral_calculators.h"
+
+// Узлы и веса квадратур Гаусса-Лежандра и Гаусса-Лобатто на [-1, 1] в порядке возрастания узлов.
+// Вычисляются методом Ньютона функциями constexpr: для правил с числом точек N - параметром шаблона
+// таблица строится при компиляции, для заданного во время выполнения числа точек - один раз
+// при первом обращении (gaussTable) и затем берётся из кэша.
+namespace gauss_detail {
+    constexpr double pi = 3.14159265358979323846;
+
+    // cos x для x из [0, pi] (ряд Тейлора): начальные приближения узлов
+    constexpr double cosine(double x) {
+        double term = 1.0, sum = 1.0;
+        for (int k = 1; k < 40; ++k) {
+            term *= -x * x / ((2 * k - 1) * (2 * k));
+            sum += term;
+        }
+        return sum;
+    }
+
+    constexpr double absolute(double x) { return x < 0 ? -x : x; }
+
+    // P_n(x) и P_n'(x) по рекуррентной формуле Бонне (|x| < 1 для производной)
+    constexpr void legendre(int n, double x, double& p, double& dp) {
+        double p0 = 1.0, p1 = x;
+        if (n == 0) p1 = 1.0;
+        for (int k = 2; k <= n; ++k) {
+            double p2 = ((2 * k - 1) * x * p1 - (k - 1) * p0) / k;
+            p0 = p1;
+            p1 = p2;
+        }
+        p = p1;
+        dp = n == 0 ? 0.0 : n * (x * p1 - p0) / (x * x - 1.0);
+    }
+
+    // n узлов Гаусса-Лежандра: корни P_n
+    constexpr void gaussLegendre(int n, double* x, double* w) {
+        for (int i = 0; i < (n + 1) / 2; ++i) {
+            double root = cosine(pi * (i + 0.75) / (n + 0.5)), p = 0.0, dp = 0.0;
+            for (int iteration = 0; iteration < 100; ++iteration) {
+                legendre(n, root, p, dp);
+                double step = p / dp;
+                root -= step;
+                if (absolute(step) <= 1e-16) break;
+            }
+            legendre(n, root, p, dp);
+            double weight = 2.0 / ((1.0 - root * root) * dp * dp);
+            x[i] = -root;
+            x[n - 1 - i] = root;
+            w[i] = w[n - 1 - i] = weight;
+        }
+        if (n % 2 == 1) x[n / 2] = 0.0;
+    }
+
+    // n узлов Гаусса-Лобатто (n >= 2): концы отрезка и корни P_{n-1}'
+    constexpr void gaussLobatto(int n, double* x, double* w) {
+        int m = n - 1;
+        x[0] = -1.0;
+        x[n - 1] = 1.0;
+        w[0] = w[n - 1] = 2.0 / (n * m);
+        for (int i = 1; i < (n + 1) / 2; ++i) {
+            double root = cosine(pi * i / m), p = 0.0, dp = 0.0;
+            for (int iteration = 0; iteration < 100; ++iteration) {
+                legendre(m, root, p, dp);
+                // P'' из уравнения Лежандра: (1 - x^2) P'' = 2 x P' - m (m + 1) P
+                double d2p = (2.0 * root * dp - m * (m + 1) * p) / (1.0 - root * root);
+                double step = dp / d2p;
+                root -= step;
+                if (absolute(step) <= 1e-16) break;
+            }
+            legendre(m, root, p, dp);
+            double weight = 2.0 / (n * m * p * p);
+            x[i] = -root;
+            x[n - 1 - i] = root;
+            w[i] = w[n - 1 - i] = weight;
+        }
+        if (n % 2 == 1) x[n / 2] = 0.0;
+    }
+
+    template <int N>
+    struct Table {
+        double nodes[N] = {};
+        double weights[N] = {};
+    };
+
+    template <int N>
+    constexpr Table<N> makeGaussLegendre() {
+        Table<N> table;
+        gaussLegendre(N, table.nodes, table.weights);
+        return table;
+    }
+
+    template <int N>
+    constexpr Table<N> makeGaussLobatto() {
+        Table<N> table;
+        gaussLobatto(N, table.nodes, table.weights);
+        return table;
+    }
+
+    // узлы составной формулы на panels равных отрезках [a, b] и веса без множителя h / 2;
+    // у правил Лобатто (shared = true) крайние узлы соседних отрезков совпадают и объединяются
+    struct CompositeLayout {
+        double a, b, h;
+        long long panels;
+        int n;
+        const double* nodes;
+        const double* weights;
+        bool shared;
+
+        CompositeLayout(double a, double b, long long panels, int n, const double* nodes, const double* weights, bool shared)
+            : a(a), b(b), h((b - a) / panels), panels(panels), n(n), nodes(nodes), weights(weights), shared(shared) {}
+
+        long long count() const { return shared ? panels * (n - 1) + 1 : panels * n; }
+
+        double node(long long i) const {
+            if (!shared) return a + (i / n) * h + 0.5 * (nodes[i % n] + 1.0) * h;
+            int step = n - 1;
+            return i == panels * step ? b : a + (i / step) * h + 0.5 * (nodes[i % step] + 1.0) * h;
+        }
+
+        double weight(long long i) const {
+            if (!shared) return weights[i % n];
+            int step = n - 1;
+            return i % step == 0 && i > 0 && i < panels * step ? 2.0 * weights[0] : weights[i % step];
+        }
+    };
+
+    template <class F>
+    double composite(F& f, double a, double b, long long panels, int n,
+                     const double* nodes, const double* weights, bool shared) {
+        CompositeLayout layout(a, b, panels, n, nodes, weights, shared);
+        double sum = quadrature_detail::weightedSum(f, 0, layout.count(),
+            [&layout](long long i) { return layout.node(i); },
+            [&layout](long long i) { return layout.weight(i); }, 0.0);
+        return 0.5 * layout.h * sum;
+    }
+
+    inline QuadratureNodes compositeNodes(double a, double b, long long panels, int n,
+                                          const double* nodes, const double* weights, bool shared) {
+        CompositeLayout layout(a, b, panels, n, nodes, weights, shared);
+        QuadratureNodes rule;
+        for (long long i = 0; i < layout.count(); ++i) {
+            rule.nodes.push_back(layout.node(i));
+            rule.weights.push_back(0.5 * layout.h * layout.weight(i));
+        }
+        return rule;
+    }
+}
+
+struct GaussTable {
+    std::vector<double> nodes;
+    std::vector<double> weights;
+};
+
+// таблица правила с n точками (lobatto = false - Гаусс-Лежандр), вычисляется при первом обращении
+const GaussTable& gaussTable(int n, bool lobatto = false);
+
+// Гаусс-Лежандр с N точками, таблица строится при компиляции; точен для многочленов степени 2N - 1
+template <int N>
+class GaussLegendreRule {
+public:
+    static constexpr gauss_detail::Table<N> table = gauss_detail::makeGaussLegendre<N>();
+
+    template <class F>
+    double compute(F f, double a, double b, long long panels = 1) const {
+        return gauss_detail::composite(f, a, b, panels, N, table.nodes, table.weights, false);
+    }
+    QuadratureNodes getNodes(double a, double b, long long panels = 1) const {
+        return gauss_detail::compositeNodes(a, b, panels, N, table.nodes, table.weights, false);
+    }
+    int getOrder() const { return 2 * N; }
+};
+
+// Гаусс-Лобатто с N точками (включая концы), точен для многочленов степени 2N - 3
+template <int N>
+class GaussLobattoRule {
+    static_assert(N >= 2, "Gauss-Lobatto rule needs at least two points");
+public:
+    static constexpr gauss_detail::Table<N> table = gauss_detail::makeGaussLobatto<N>();
+
+    template <class F>
+    double compute(F f, double a, double b, long long panels = 1) const {
+        return gauss_detail::composite(f, a, b, panels, N, table.nodes, table.weights, true);
+    }
+    QuadratureNodes getNodes(double a, double b, long long panels = 1) const {
+        return gauss_detail::compositeNodes(a, b, panels, N, table.nodes, table.weights, true);
+    }
+    int getOrder() const { return 2 * N - 2; }
+};
+
+template <int N>
+constexpr gauss_detail::Table<N> GaussLegendreRule<N>::table;
+
+template <int N>
+constexpr gauss_detail::Table<N> GaussLobattoRule<N>::table;
+
+// Правило Гаусса с числом точек, заданным во время выполнения (таблица из кэша gaussTable)
+class GaussRule {
+public:
+    GaussRule(int points, bool lobatto = false) : points(points), lobatto(lobatto), table(&gaussTable(points, lobatto)) {}
+
+    template <class F>
+    double compute(F f, double a, double b, long long panels = 1) const {
+        return gauss_detail::composite(f, a, b, panels, points, table->nodes.data(), table->weights.data(), lobatto);
+    }
+    // узлы и веса составной формулы (у формулы Лобатто общие узлы соседних отрезков объединены)
+    QuadratureNodes getNodes(double a, double b, long long panels = 1) const {
+        return gauss_detail::compositeNodes(a, b, panels, points, table->nodes.data(), table->weights.data(), lobatto);
+    }
+    int getOrder() const { return lobatto ? 2 * points - 2 : 2 * points; }
+
+private:
+    int points;
+    bool lobatto;
+    const GaussTable* table;
+};
+
+#endif
\ No newline at end of file
@@ -1,23 +1,42 @@
 #include <cmath>
 #include "integral_calculators.h"
 
-double TrapezoidalRule::compute(double (*f)(double), double a, double b, int n) {
+QuadratureNodes TrapezoidalRule::getNodes(double a, double b, long long n) const {
+    QuadratureNodes rule;
     double h = (b - a) / n;
-    double sum = 0.5 * (f(a) + f(b));
-    for (int i = 1; i < n; ++i) sum += f(a + i * h);
-    return sum * h;
+    for (long long i = 0; i <= n; ++i) {
+        rule.nodes.push_back(a + i * h);
+        rule.weights.push_back(i == 0 || i == n ? 0.5 * h : h);
+    }
+    return rule;
 }
 
-double SimpsonRule::compute(double (*f)(double), double a, double b, int n) {
+QuadratureNodes SimpsonRule::getNodes(double a, double b, long long n) const {
+    QuadratureNodes rule;
     double h = (b - a) / n;
-    double sum = f(a) + f(b);
-    for (int i = 1; i < n; ++i) {
-        double x = a + i * h;
-        sum += (i % 2 == 0 ? 2 : 4) * f(x);
+    for (long long i = 0; i <= n; ++i) {
+        rule.nodes.push_back(a + i * h);
+        rule.weights.push_back((i == 0 || i == n ? 1.0 : (i % 2 == 0 ? 2.0 : 4.0)) * h / 3.0);
     }
-    return sum * h / 3.0;
+    return rule;
 }
 
 double RichardsonExtrapolation::compute(double Ih, double Ih2, int k) {
     return Ih2 + (Ih2 - Ih) / (std::pow(2, k) - 1);
+}
+
+namespace quadrature_detail {
+    const double xgk[8] = {
+        0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+        0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+        0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+        0.207784955007898467600689403773245, 0.0 };
+    const double wgk[8] = {
+        0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+        0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+        0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+        0.204432940075298892414161999234649, 0.209482141084727828012999174891714 };
+    const double wg[4] = {
+        0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+        0.381830050505118944950369775488975, 0.417959183673469387755102040816327 };
 }
\ No newline at end of file
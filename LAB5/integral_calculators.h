@@ -1,15 +1,170 @@
 #ifndef INTEGRAL_CALCULATORS_H
 #define INTEGRAL_CALCULATORS_H
 
+#include <vector>
+#include <queue>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+// Подынтегральная функция f - любой вызываемый объект double(double) (функция, лямбда с захватом,
+// функтор): правила - шаблоны, поэтому вызов f встраивается. Дорогие функции можно передать
+// в пакетном виде makeBatchIntegrand(g), где g(const double* x, double* y, size_t n) вычисляет
+// y[i] = f(x[i]); тогда узлы передаются блоками по blockSize точек.
+template <class F>
+struct BatchIntegrand {
+    F f;
+    std::size_t blockSize;
+};
+
+template <class F>
+BatchIntegrand<F> makeBatchIntegrand(F f, std::size_t blockSize = 256) {
+    return { f, blockSize > 0 ? blockSize : 1 };
+}
+
+namespace quadrature_detail {
+    template <class F>
+    void evaluate(F& f, const double* x, double* y, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) y[i] = f(x[i]);
+    }
+
+    template <class F>
+    void evaluate(BatchIntegrand<F>& f, const double* x, double* y, std::size_t n) {
+        f.f(x, y, n);
+    }
+
+    template <class F>
+    double evaluate(F& f, double x) {
+        double y;
+        evaluate(f, &x, &y, 1);
+        return y;
+    }
+
+    // sum + sum_{i=first}^{last-1} weight(i) * f(node(i))
+    template <class F, class Node, class Weight>
+    double weightedSum(F& f, long long first, long long last, Node node, Weight weight, double sum) {
+        for (long long i = first; i < last; ++i) sum += weight(i) * f(node(i));
+        return sum;
+    }
+
+    template <class F, class Node, class Weight>
+    double weightedSum(BatchIntegrand<F>& f, long long first, long long last, Node node, Weight weight, double sum) {
+        std::vector<double> x(f.blockSize), y(f.blockSize);
+        for (long long start = first; start < last; start += static_cast<long long>(f.blockSize)) {
+            std::size_t count = static_cast<std::size_t>(std::min<long long>(f.blockSize, last - start));
+            for (std::size_t k = 0; k < count; ++k) x[k] = node(start + k);
+            f.f(x.data(), y.data(), count);
+            for (std::size_t k = 0; k < count; ++k) sum += weight(start + k) * y[k];
+        }
+        return sum;
+    }
+
+    // сумма Ноймайера (компенсированное суммирование Кэхэна-Ноймайера)
+    struct NeumaierSum {
+        double sum = 0.0, compensation = 0.0;
+
+        void add(double value) {
+            double t = sum + value;
+            if (std::abs(sum) >= std::abs(value)) compensation += (sum - t) + value;
+            else compensation += (value - t) + sum;
+            sum = t;
+        }
+        double value() const { return sum + compensation; }
+    };
+
+    template <class F, class Node, class Weight>
+    void compensatedSum(F& f, long long first, long long last, Node node, Weight weight, NeumaierSum& sum) {
+        for (long long i = first; i < last; ++i) sum.add(weight(i) * f(node(i)));
+    }
+
+    template <class F, class Node, class Weight>
+    void compensatedSum(BatchIntegrand<F>& f, long long first, long long last, Node node, Weight weight, NeumaierSum& sum) {
+        std::vector<double> x(f.blockSize), y(f.blockSize);
+        for (long long start = first; start < last; start += static_cast<long long>(f.blockSize)) {
+            std::size_t count = static_cast<std::size_t>(std::min<long long>(f.blockSize, last - start));
+            for (std::size_t k = 0; k < count; ++k) x[k] = node(start + k);
+            f.f(x.data(), y.data(), count);
+            for (std::size_t k = 0; k < count; ++k) sum.add(weight(start + k) * y[k]);
+        }
+    }
+
+    // число потоков для count задач: numThreads <= 0 - по числу ядер, не больше count
+    inline int threadCount(int numThreads, long long count) {
+        if (numThreads <= 0) numThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        return static_cast<int>(std::max(1LL, std::min<long long>(numThreads, count)));
+    }
+
+    // work(t, from, to) для numThreads непрерывных диапазонов [from, to) из [first, last);
+    // диапазон 0 обрабатывается в вызывающем потоке
+    template <class Work>
+    void parallelRanges(long long first, long long last, int numThreads, Work work) {
+        long long count = last - first;
+        auto run = [&](int t) {
+            long long from = first + count / numThreads * t + std::min<long long>(t, count % numThreads);
+            long long to = from + count / numThreads + (t < count % numThreads ? 1 : 0);
+            work(t, from, to);
+        };
+
+        std::vector<std::thread> threads;
+        for (int t = 1; t < numThreads; ++t) threads.emplace_back(run, t);
+        run(0);
+        for (auto& thread : threads) thread.join();
+    }
+
+    // sum_{i=first}^{last-1} weight(i) * f(node(i)) в numThreads потоках (0 - по числу ядер):
+    // поток t суммирует свой непрерывный диапазон узлов по Ноймайеру, частичные суммы складываются
+    // в порядке номеров потоков, поэтому при заданном numThreads результат воспроизводится побитово.
+    // f вызывается из нескольких потоков одновременно
+    template <class F, class Node, class Weight>
+    double parallelCompensatedSum(F& f, long long first, long long last, Node node, Weight weight, int numThreads) {
+        numThreads = threadCount(numThreads, last - first);
+        std::vector<NeumaierSum> partial(numThreads);
+        parallelRanges(first, last, numThreads, [&](int t, long long from, long long to) {
+            compensatedSum(f, from, to, node, weight, partial[t]);
+        });
+
+        NeumaierSum total;
+        for (const auto& p : partial) {
+            total.add(p.sum);
+            total.add(p.compensation);
+        }
+        return total.value();
+    }
+
+    // узлы и веса Кронрода (15 точек) и Гаусса (7 точек, узлы xgk[1], xgk[3], xgk[5], xgk[7])
+    extern const double xgk[8];
+    extern const double wgk[8];
+    extern const double wg[4];
+}
+
+// Квадратурная формула как набор узлов и весов на [a, b]: I = sum weights[i] * f(nodes[i])
+struct QuadratureNodes {
+    std::vector<double> nodes;
+    std::vector<double> weights;
+};
+
+// computeParallel - та же формула для больших n: узлы делятся между numThreads потоками
+// (0 - по числу ядер), суммирование компенсированное (Ноймайер), результат при заданном числе
+// потоков детерминирован; f должна допускать одновременные вызовы из нескольких потоков
 class TrapezoidalRule {
 public:
-    double compute(double (*f)(double), double a, double b, int n);
+    template <class F>
+    double compute(F f, double a, double b, long long n);
+    template <class F>
+    double computeParallel(F f, double a, double b, long long n, int numThreads = 0);
+    QuadratureNodes getNodes(double a, double b, long long n) const;
     int getOrder() const { return 2; }
 };
 
 class SimpsonRule {
 public:
-    double compute(double (*f)(double), double a, double b, int n);
+    template <class F>
+    double compute(F f, double a, double b, long long n);
+    template <class F>
+    double computeParallel(F f, double a, double b, long long n, int numThreads = 0);
+    QuadratureNodes getNodes(double a, double b, long long n) const;
     int getOrder() const { return 4; }
 };
 
@@ -18,4 +173,281 @@ public:
     static double compute(double Ih, double Ih2, int k);
 };
 
+struct IntegrationResult {
+    double value = 0.0;
+    double error = 0.0;          // оценка абсолютной погрешности
+    long long evaluations = 0;   // число вычислений подынтегральной функции
+    bool converged = false;      // достигнута ли max(absTol, relTol * |value|)
+};
+
+// Глобально адаптивная квадратура Гаусса-Кронрода G7-K15: на каждом шаге делится пополам
+// отрезок с наибольшей оценкой погрешности |K15 - G7| (очередь с приоритетом)
+class GaussKronrodIntegrator {
+public:
+    template <class F>
+    IntegrationResult compute(F f, double a, double b,
+                              double absTol, double relTol, int maxIntervals = 1000);
+
+private:
+    struct Interval {
+        double a, b, value, error;
+        bool operator<(const Interval& other) const { return error < other.error; }
+    };
+
+    template <class F>
+    static Interval gaussKronrod15(F& f, double a, double b);
+};
+
+// Локально адаптивная формула Симпсона: отрезок делится, пока поправка Ричардсона
+// (S(h/2) - S(h)) / (2^4 - 1) больше допуска; результат уточняется экстраполяцией
+class AdaptiveSimpsonRule {
+public:
+    template <class F>
+    IntegrationResult compute(F f, double a, double b,
+                              double absTol, double relTol, int maxDepth = 50);
+    int getOrder() const { return 4; }
+
+private:
+    // fa, fm, fb - значения в концах и середине [a, b], whole - формула Симпсона на [a, b]
+    template <class F>
+    static double refine(F& f, IntegrationResult& result, double a, double b, double fa, double fm, double fb,
+                         double whole, double tol, int depth);
+};
+
+// Метод Ромберга: формула трапеций на вложенных сетках n0, 2 n0, 4 n0, ... (на каждом уровне
+// вычисляются только новые середины отрезков) и таблица экстраполяции Ричардсона
+// table[i][j] = RichardsonExtrapolation::compute(table[i-1][j-1], table[i][j-1], 2j),
+// столбец j имеет порядок 2(j+1); table[i][1] совпадает с формулой Симпсона на 2 n0 2^(i-1) отрезках
+class RombergIntegrator {
+public:
+    // таблица из levels строк и не более maxColumns столбцов (maxColumns <= 0 - полная треугольная)
+    template <class F>
+    std::vector<std::vector<double>> computeTable(F f, double a, double b,
+                                                  int n0, int levels, int maxColumns = 0);
+    // измельчение до достижения max(absTol, relTol * |I|) разностью последних диагональных элементов
+    template <class F>
+    IntegrationResult compute(F f, double a, double b,
+                              double absTol, double relTol, int maxLevels = 20, int n0 = 1);
+    long long getEvaluations() const { return evaluations; }
+
+private:
+    long long evaluations = 0;
+
+    // вложенные сетки формулы трапеций: sum - сумма значений с весами 1/2 в концах, h - текущий шаг
+    template <class F>
+    struct NestedTrapezoid {
+        F& f;
+        double a;
+        long long n;
+        double h, sum;
+        long long evaluations;
+
+        NestedTrapezoid(F& f, double a, double b, long long n0)
+            : f(f), a(a), n(n0), h((b - a) / n0), evaluations(n0 + 1) {
+            double h = this->h;
+            sum = quadrature_detail::weightedSum(f, 1, n,
+                [a, h](long long i) { return a + i * h; }, [](long long) { return 1.0; },
+                0.5 * (quadrature_detail::evaluate(f, a) + quadrature_detail::evaluate(f, b)));
+        }
+
+        // переход к вдвое более мелкой сетке: вычисляются только n новых середин
+        void refine() {
+            h *= 0.5;
+            double a = this->a, h = this->h;
+            sum = quadrature_detail::weightedSum(f, 0, n,
+                [a, h](long long i) { return a + (2 * i + 1) * h; }, [](long long) { return 1.0; }, sum);
+            evaluations += n;
+            n *= 2;
+        }
+
+        double value() const { return sum * h; }
+    };
+};
+
+template <class F>
+double TrapezoidalRule::compute(F f, double a, double b, long long n) {
+    double h = (b - a) / n;
+    double sum = 0.5 * (quadrature_detail::evaluate(f, a) + quadrature_detail::evaluate(f, b));
+    sum = quadrature_detail::weightedSum(f, 1, n,
+        [a, h](long long i) { return a + i * h; }, [](long long) { return 1.0; }, sum);
+    return sum * h;
+}
+
+template <class F>
+double SimpsonRule::compute(F f, double a, double b, long long n) {
+    double h = (b - a) / n;
+    double sum = quadrature_detail::evaluate(f, a) + quadrature_detail::evaluate(f, b);
+    sum = quadrature_detail::weightedSum(f, 1, n,
+        [a, h](long long i) { return a + i * h; }, [](long long i) { return i % 2 == 0 ? 2.0 : 4.0; }, sum);
+    return sum * h / 3.0;
+}
+
+template <class F>
+double TrapezoidalRule::computeParallel(F f, double a, double b, long long n, int numThreads) {
+    double h = (b - a) / n;
+    double sum = quadrature_detail::parallelCompensatedSum(f, 0, n + 1,
+        [a, h](long long i) { return a + i * h; },
+        [n](long long i) { return i == 0 || i == n ? 0.5 : 1.0; }, numThreads);
+    return sum * h;
+}
+
+template <class F>
+double SimpsonRule::computeParallel(F f, double a, double b, long long n, int numThreads) {
+    double h = (b - a) / n;
+    double sum = quadrature_detail::parallelCompensatedSum(f, 0, n + 1,
+        [a, h](long long i) { return a + i * h; },
+        [n](long long i) { return i == 0 || i == n ? 1.0 : (i % 2 == 0 ? 2.0 : 4.0); }, numThreads);
+    return sum * h / 3.0;
+}
+
+template <class F>
+GaussKronrodIntegrator::Interval GaussKronrodIntegrator::gaussKronrod15(F& f, double a, double b) {
+    using namespace quadrature_detail;
+    double center = 0.5 * (a + b), halfLength = 0.5 * (b - a);
+
+    // все 15 узлов вычисляются одним вызовом: x[0] - центр, x[2j + 1], x[2j + 2] - пара узлов j
+    double x[15], y[15];
+    x[0] = center;
+    for (int j = 0; j < 7; ++j) {
+        double dx = halfLength * xgk[j];
+        x[2 * j + 1] = center - dx;
+        x[2 * j + 2] = center + dx;
+    }
+    evaluate(f, x, y, 15);
+
+    double kronrod = wgk[7] * y[0], gauss = wg[3] * y[0];
+    for (int j = 0; j < 7; ++j) {
+        double fsum = y[2 * j + 1] + y[2 * j + 2];
+        kronrod += wgk[j] * fsum;
+        if (j % 2 == 1) gauss += wg[j / 2] * fsum;
+    }
+    // оценка погрешности не меньше уровня ошибок округления
+    double roundoff = 50.0 * std::numeric_limits<double>::epsilon() * std::abs(kronrod * halfLength);
+    return { a, b, kronrod * halfLength, std::max(std::abs((kronrod - gauss) * halfLength), roundoff) };
+}
+
+template <class F>
+IntegrationResult GaussKronrodIntegrator::compute(F f, double a, double b,
+                                                  double absTol, double relTol, int maxIntervals) {
+    IntegrationResult result;
+    std::priority_queue<Interval> intervals;
+    intervals.push(gaussKronrod15(f, a, b));
+    result.evaluations = 15;
+    result.value = intervals.top().value;
+    result.error = intervals.top().error;
+
+    while (result.error > std::max(absTol, relTol * std::abs(result.value)) &&
+           static_cast<int>(intervals.size()) < maxIntervals) {
+        Interval worst = intervals.top();
+        intervals.pop();
+        double m = 0.5 * (worst.a + worst.b);
+        Interval left = gaussKronrod15(f, worst.a, m), right = gaussKronrod15(f, m, worst.b);
+        result.evaluations += 30;
+        result.value += left.value + right.value - worst.value;
+        result.error += left.error + right.error - worst.error;
+        intervals.push(left);
+        intervals.push(right);
+    }
+
+    // итоговые суммы пересчитываются заново, чтобы не накапливать ошибки округления обновлений
+    result.value = result.error = 0.0;
+    std::vector<Interval> all;
+    all.reserve(intervals.size());
+    while (!intervals.empty()) {
+        all.push_back(intervals.top());
+        intervals.pop();
+    }
+    for (auto it = all.rbegin(); it != all.rend(); ++it) {
+        result.value += it->value;
+        result.error += it->error;
+    }
+    result.converged = result.error <= std::max(absTol, relTol * std::abs(result.value));
+    return result;
+}
+
+template <class F>
+double AdaptiveSimpsonRule::refine(F& f, IntegrationResult& result, double a, double b, double fa, double fm, double fb,
+                                   double whole, double tol, int depth) {
+    double m = 0.5 * (a + b);
+    double x[2] = { 0.5 * (a + m), 0.5 * (m + b) }, y[2];
+    quadrature_detail::evaluate(f, x, y, 2);
+    double flm = y[0], frm = y[1];
+    result.evaluations += 2;
+    double left = (m - a) / 6.0 * (fa + 4.0 * flm + fm);
+    double right = (b - m) / 6.0 * (fm + 4.0 * frm + fb);
+    double halves = left + right;
+    double correction = std::abs(halves - whole) / (std::pow(2, 4) - 1);
+
+    if (correction <= tol || depth <= 0) {
+        if (correction > tol) result.converged = false;
+        result.error += correction;
+        return RichardsonExtrapolation::compute(whole, halves, 4);
+    }
+    return refine(f, result, a, m, fa, flm, fm, left, 0.5 * tol, depth - 1) +
+           refine(f, result, m, b, fm, frm, fb, right, 0.5 * tol, depth - 1);
+}
+
+template <class F>
+IntegrationResult AdaptiveSimpsonRule::compute(F f, double a, double b,
+                                               double absTol, double relTol, int maxDepth) {
+    IntegrationResult result;
+    double x[3] = { a, 0.5 * (a + b), b }, y[3];
+    quadrature_detail::evaluate(f, x, y, 3);
+    double whole = (b - a) / 6.0 * (y[0] + 4.0 * y[1] + y[2]);
+    double tol = std::max(absTol, relTol * std::abs(whole));
+
+    result.evaluations = 3;
+    result.converged = true;
+    double value = refine(f, result, a, b, y[0], y[1], y[2], whole, tol, maxDepth);
+    result.value = value;
+    return result;
+}
+
+template <class F>
+std::vector<std::vector<double>> RombergIntegrator::computeTable(F f, double a, double b,
+                                                                 int n0, int levels, int maxColumns) {
+    std::vector<std::vector<double>> table;
+    if (maxColumns <= 0) maxColumns = levels;
+
+    NestedTrapezoid<F> trapezoid(f, a, b, n0);
+    table.push_back({ trapezoid.value() });
+    for (int level = 1; level < levels; ++level) {
+        trapezoid.refine();
+        std::vector<double> row = { trapezoid.value() };
+        for (int j = 1; j <= level && j < maxColumns; ++j)
+            row.push_back(RichardsonExtrapolation::compute(table[level - 1][j - 1], row[j - 1], 2 * j));
+        table.push_back(row);
+    }
+    evaluations = trapezoid.evaluations;
+    return table;
+}
+
+template <class F>
+IntegrationResult RombergIntegrator::compute(F f, double a, double b,
+                                             double absTol, double relTol, int maxLevels, int n0) {
+    IntegrationResult result;
+    NestedTrapezoid<F> trapezoid(f, a, b, n0);
+    std::vector<double> previous = { trapezoid.value() }, row;
+    result.value = previous[0];
+    result.error = std::abs(result.value);
+
+    for (int level = 1; level < maxLevels; ++level) {
+        trapezoid.refine();
+        row.assign(1, trapezoid.value());
+        for (int j = 1; j <= level; ++j)
+            row.push_back(RichardsonExtrapolation::compute(previous[j - 1], row[j - 1], 2 * j));
+
+        result.value = row.back();
+        result.error = std::abs(row.back() - previous.back());
+        // на первых уровнях разность может оказаться случайно малой
+        if (level >= 3 && result.error <= std::max(absTol, relTol * std::abs(result.value))) {
+            result.converged = true;
+            break;
+        }
+        previous.swap(row);
+    }
+    result.evaluations = evaluations = trapezoid.evaluations;
+    return result;
+}
+
 #endif
\ No newline at end of file
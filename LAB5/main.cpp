@@ -4,6 +4,8 @@
 #include <iomanip>
 #include <iomanip>
 #include "integral_calculators.h"
+#include "gauss_rules.h"
+#include "tanh_sinh.h"
 
 int main() {
     auto f = [](double x) { return std::exp(x); };
@@ -20,11 +22,17 @@ int main() {
     TrapezoidalRule trapezoid;
     SimpsonRule simpson;
 
+    // формулы трапеций и Симпсона для всех n берутся из таблицы Ромберга на вложенных сетках
+    // n = 2, 4, ..., 32: каждый узел вычисляется один раз
+    RombergIntegrator romberg;
+    std::vector<std::vector<double>> table = romberg.computeTable(f, a, b, N.front() / 2, (int)N.size() + 1);
+
     std::vector<double> I_trap, I_simp;
-    for (int n : N) {
-        I_trap.push_back(trapezoid.compute(f, a, b, n));
-        I_simp.push_back(simpson.compute(f, a, b, n));
+    for (size_t i = 0; i < N.size(); i++) {
+        I_trap.push_back(table[i + 1][0]);
+        I_simp.push_back(table[i + 1][1]);
     }
+    std::cout << "Function evaluations (Romberg table): " << romberg.getEvaluations() << "\n\n";
 
     auto printTable = [&](const std::vector<double>& I, int k, const std::string& name) {
         std::cout << name << " (k=" << k << ")\n";
@@ -61,5 +69,32 @@ int main() {
     for (double val : I_simp) std::cout << val << " ";
     std::cout << "\n";
 
+    auto printAdaptive = [&](const IntegrationResult& r, const std::string& name) {
+        std::cout << name << ": I = " << r.value << ", I*-I = " << I_star - r.value
+                  << ", оценка погрешности = " << r.error << ", вычислений f = " << r.evaluations
+                  << (r.converged ? "" : " (точность не достигнута)") << "\n";
+    };
+
+    std::cout << "\nАдаптивные методы (absTol = relTol = 1e-12):\n";
+    printAdaptive(GaussKronrodIntegrator().compute(f, a, b, 1e-12, 1e-12), "Gauss-Kronrod G7-K15");
+    printAdaptive(AdaptiveSimpsonRule().compute(f, a, b, 1e-12, 1e-12), "Adaptive Simpson    ");
+    printAdaptive(RombergIntegrator().compute(f, a, b, 1e-12, 1e-12), "Romberg             ");
+    printAdaptive(TanhSinhIntegrator().compute(f, a, b, 1e-12, 1e-12), "Tanh-sinh           ");
+
+    std::cout << "\nGauss-Legendre (5 точек): I*-I = " << I_star - GaussLegendreRule<5>().compute(f, a, b)
+              << ", (8 точек): I*-I = " << I_star - GaussLegendreRule<8>().compute(f, a, b) << "\n";
+    std::cout << "Gauss-Lobatto (8 точек): I*-I = " << I_star - GaussLobattoRule<8>().compute(f, a, b) << "\n";
+
+    long long n_large = 10000000;
+    std::cout << "\nSimpson n = " << n_large << ": обычное суммирование I*-I = "
+              << I_star - simpson.compute(f, a, b, n_large) << ", параллельное компенсированное I*-I = "
+              << I_star - simpson.computeParallel(f, a, b, n_large) << "\n";
+
+    std::cout << "\nТаблица Ромберга (строка i - n = " << N.front() / 2 << " * 2^i):\n";
+    for (const auto& row : table) {
+        for (double val : row) std::cout << std::setw(24) << val;
+        std::cout << "\n";
+    }
+
     return 0;
 }
\ No newline at end of file
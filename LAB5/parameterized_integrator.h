@@ -0,0 +1,85 @@
+#ifndef PARAMETERIZED_INTEGRATOR_H
+#define PARAMETERIZED_INTEGRATOR_H
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include "integral_calculators.h"
+
+// Интегралы I_k = int_a^b f(x, theta_k) dx для массива параметров theta по одной квадратурной формуле.
+// Узлы и веса строятся один раз (getNodes любого правила). Параметры делятся на блоки по blockSize,
+// блоки распределяются между потоками (numThreads = 0 - по числу ядер); внутри блока для каждого узла
+// f вычисляется подряд для всех параметров блока, и суммы блока хранятся массивом (SoA), так что цикл
+// по параметрам векторизуется. Дорогую f можно передать в пакетном виде makeParameterBatchIntegrand(g).
+// Каждый интеграл суммируется одним потоком в порядке узлов, поэтому результат не зависит от числа потоков.
+class ParameterizedIntegrator;
+
+// Пакетная подынтегральная функция семейства: g(double x, const double* theta, double* y, size_t m)
+// вычисляет y[k] = f(x, theta[k]) для m параметров блока. В отличие от BatchIntegrand, пакет идёт
+// по параметрам при фиксированном узле, а его размер задаёт blockSize интегратора.
+template <class F>
+struct ParameterBatchIntegrand {
+    F f;
+};
+
+template <class F>
+ParameterBatchIntegrand<F> makeParameterBatchIntegrand(F f) {
+    return { f };
+}
+
+class ParameterizedIntegrator {
+public:
+    explicit ParameterizedIntegrator(QuadratureNodes rule, std::size_t blockSize = 64)
+        : rule(std::move(rule)), blockSize(std::max<std::size_t>(1, blockSize)) {}
+
+    template <class F>
+    std::vector<double> compute(F f, const std::vector<double>& theta, int numThreads = 0) const {
+        std::vector<double> result(theta.size());
+        compute(f, theta.data(), theta.size(), result.data(), numThreads);
+        return result;
+    }
+
+    template <class F>
+    void compute(F f, const double* theta, std::size_t count, double* result, int numThreads = 0) const;
+
+    std::size_t getNodeCount() const { return rule.nodes.size(); }
+
+private:
+    QuadratureNodes rule;
+    std::size_t blockSize;
+
+    template <class F>
+    static void evaluate(F& f, double x, const double* theta, double* y, std::size_t m) {
+        for (std::size_t k = 0; k < m; ++k) y[k] = f(x, theta[k]);
+    }
+
+    template <class F>
+    static void evaluate(ParameterBatchIntegrand<F>& f, double x, const double* theta, double* y, std::size_t m) {
+        f.f(x, theta, y, m);
+    }
+};
+
+template <class F>
+void ParameterizedIntegrator::compute(F f, const double* theta, std::size_t count, double* result, int numThreads) const {
+    long long blocks = static_cast<long long>((count + blockSize - 1) / blockSize);
+    if (blocks == 0) return;
+    numThreads = quadrature_detail::threadCount(numThreads, blocks);
+
+    quadrature_detail::parallelRanges(0, blocks, numThreads, [&](int, long long from, long long to) {
+        std::vector<double> y(blockSize);
+        for (long long block = from; block < to; ++block) {
+            std::size_t first = static_cast<std::size_t>(block) * blockSize;
+            std::size_t m = std::min(blockSize, count - first);
+            double* sum = result + first;
+            std::fill(sum, sum + m, 0.0);
+
+            for (std::size_t i = 0; i < rule.nodes.size(); ++i) {
+                evaluate(f, rule.nodes[i], theta + first, y.data(), m);
+                double w = rule.weights[i];
+                for (std::size_t k = 0; k < m; ++k) sum[k] += w * y[k];
+            }
+        }
+    });
+}
+
+#endif
\ No newline at end of file
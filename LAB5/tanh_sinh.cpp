@@ -0,0 +1,60 @@
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "tanh_sinh.h"
+
+TanhSinhIntegrator::TanhSinhIntegrator(int maxLevel)
+    : maxLevel(maxLevel), finite(maxLevel + 1), halfLine(maxLevel + 1), wholeLine(maxLevel + 1) {
+    if (maxLevel < 2 || maxLevel > 20) throw std::invalid_argument("TanhSinhIntegrator: maxLevel must be in [2, 20]");
+
+    const double pi = 3.14159265358979323846;
+    const double tiny = std::numeric_limits<double>::min();
+    const double huge = 1e150;   // дальше хвосты не вносят вклада, а веса близки к переполнению
+
+    for (int level = 0; level <= maxLevel; ++level) {
+        double h = std::ldexp(1.0, -level);
+        // уровень 0 - узлы t = k, уровень j > 0 - новые узлы t = (2k + 1) 2^-j
+        for (long long k = 1; ; ++k) {
+            if (level > 0 && k % 2 == 0) continue;
+            double t = k * h;
+            double s = pi / 2 * std::sinh(t), ch = std::cosh(t);
+            bool any = false;
+
+            // tanh-sinh: расстояние до конца 1 - tanh(s) = 1 / (exp(s) cosh(s))
+            double distance = 1.0 / (std::exp(s) * std::cosh(s));
+            if (distance > tiny) {
+                double cs = std::cosh(s);
+                finite[level].u.push_back(distance);
+                finite[level].w.push_back(pi / 2 * ch / (cs * cs));
+                any = true;
+            }
+
+            // exp-sinh: узлы t и -t
+            double e = std::exp(s);
+            if (e < huge) {
+                halfLine[level].u.push_back(e);
+                halfLine[level].w.push_back(pi / 2 * ch * e);
+                any = true;
+            }
+            if (1.0 / e > tiny) {
+                halfLine[level].u.push_back(1.0 / e);
+                halfLine[level].w.push_back(pi / 2 * ch / e);
+                any = true;
+            }
+
+            // sinh-sinh
+            double sh = std::sinh(s);
+            if (sh < huge) {
+                wholeLine[level].u.push_back(sh);
+                wholeLine[level].w.push_back(pi / 2 * ch * std::cosh(s));
+                any = true;
+            }
+
+            if (!any) break;
+        }
+        if (level == 0) {
+            halfLine[0].u.push_back(1.0);
+            halfLine[0].w.push_back(pi / 2);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#ifndef TANH_SINH_H
+#define TANH_SINH_H
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "integral_calculators.h"
+
+// Двойная экспоненциальная квадратура (tanh-sinh) для функций с особенностями на концах отрезка
+// и для бесконечных промежутков. После замены x = x(t) интеграл берётся формулой трапеций по t
+// с шагом h = 2^-level; подынтегральная функция в новых переменных убывает дважды экспоненциально,
+// поэтому погрешность убывает экспоненциально с числом узлов даже при особенностях вида (x - a)^-0.9.
+//   [a, b]:         x = c + (b - a)/2 tanh(pi/2 sinh t)   (tanh-sinh)
+//   [a, +inf):      x = a + exp(pi/2 sinh t)              (exp-sinh), (-inf, b] - симметрично
+//   (-inf, +inf):   x = sinh(pi/2 sinh t)                 (sinh-sinh)
+// Узлы и веса всех уровней вычисляются в конструкторе; на каждом уровне добавляются только новые узлы.
+// Для [a, b] хранится расстояние узла до ближайшего конца, поэтому f вычисляется сколь угодно близко
+// к особенности без потери точности (сама f в концах не вычисляется). Оценка погрешности -
+// разность результатов двух последних уровней.
+class TanhSinhIntegrator {
+public:
+    explicit TanhSinhIntegrator(int maxLevel = 10);
+
+    // a и b могут быть равны -/+std::numeric_limits<double>::infinity()
+    template <class F>
+    IntegrationResult compute(F f, double a, double b, double absTol, double relTol);
+    int getMaxLevel() const { return maxLevel; }
+
+private:
+    // узлы уровня: u - параметр узла (см. compute), w - вес без множителя h
+    struct Level {
+        std::vector<double> u, w;
+    };
+
+    int maxLevel;
+    std::vector<Level> finite;      // u = расстояние до конца [-1, 1], t > 0
+    std::vector<Level> halfLine;    // u = exp(pi/2 sinh t), t любого знака
+    std::vector<Level> wholeLine;   // u = sinh(pi/2 sinh t), t > 0
+};
+
+template <class F>
+IntegrationResult TanhSinhIntegrator::compute(F f, double a, double b, double absTol, double relTol) {
+    IntegrationResult result;
+    if (a == b) {
+        result.converged = true;
+        return result;
+    }
+    if (a > b) {
+        result = compute(f, b, a, absTol, relTol);
+        result.value = -result.value;
+        return result;
+    }
+
+    const double pi = 3.14159265358979323846;
+    bool lowerInfinite = std::isinf(a), upperInfinite = std::isinf(b);
+    double half = 0.5 * (b - a), center = 0.5 * (a + b);
+
+    // узлы и веса уровня в исходной переменной x
+    std::vector<double> x, w;
+    auto layout = [&](int level) {
+        x.clear();
+        w.clear();
+        if (!lowerInfinite && !upperInfinite) {
+            if (level == 0) {
+                x.push_back(center);
+                w.push_back(half * pi / 2);
+            }
+            const Level& l = finite[level];
+            for (std::size_t i = 0; i < l.u.size(); ++i) {
+                double left = a + half * l.u[i], right = b - half * l.u[i];
+                if (left > a) { x.push_back(left); w.push_back(half * l.w[i]); }
+                if (right < b) { x.push_back(right); w.push_back(half * l.w[i]); }
+            }
+        }
+        else if (lowerInfinite && upperInfinite) {
+            if (level == 0) {
+                x.push_back(0.0);
+                w.push_back(pi / 2);
+            }
+            const Level& l = wholeLine[level];
+            for (std::size_t i = 0; i < l.u.size(); ++i) {
+                x.push_back(-l.u[i]); w.push_back(l.w[i]);
+                x.push_back(l.u[i]);  w.push_back(l.w[i]);
+            }
+        }
+        else {
+            const Level& l = halfLine[level];
+            for (std::size_t i = 0; i < l.u.size(); ++i) {
+                double point = lowerInfinite ? b - l.u[i] : a + l.u[i];
+                if (point != (lowerInfinite ? b : a)) { x.push_back(point); w.push_back(l.w[i]); }
+            }
+        }
+    };
+
+    double sum = 0.0, previous = 0.0;
+    for (int level = 0; level <= maxLevel; ++level) {
+        layout(level);
+        sum = quadrature_detail::weightedSum(f, 0, static_cast<long long>(x.size()),
+            [&x](long long i) { return x[i]; }, [&w](long long i) { return w[i]; }, sum);
+        result.evaluations += static_cast<long long>(x.size());
+
+        double h = std::ldexp(1.0, -level);
+        result.value = sum * h;
+        if (level > 0) {
+            result.error = std::abs(result.value - previous);
+            if (level >= 2 && result.error <= std::max(absTol, relTol * std::abs(result.value))) {
+                result.converged = true;
+                break;
+            }
+        }
+        previous = result.value;
+    }
+    return result;
+}
+
+#endif
\ No newline at end of file
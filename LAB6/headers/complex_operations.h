@@ -12,6 +12,19 @@ std::vector<Complex> idft(const std::vector<Complex>& input);
 std::vector<Complex> fft(const std::vector<Complex>& input);
 std::vector<Complex> ifft(const std::vector<Complex>& input);
 
+// Без выделения памяти: на месте или в буфер output длины N; N == 0 - ничего не делается
+void fft(Complex* data, int N);
+void fft(const Complex* input, Complex* output, int N);
+void ifft(Complex* data, int N);
+void ifft(const Complex* input, Complex* output, int N);
+
+// БПФ вещественного сигнала: N отсчётов <-> N/2+1 неизбыточных частот
+// (irfft бросает invalid_argument, если spectrum.size() != N/2+1)
+std::vector<Complex> rfft(const std::vector<double>& input);
+std::vector<double> irfft(const std::vector<Complex>& spectrum, int N);
+void rfft(const double* input, Complex* output, int N);
+void irfft(const Complex* input, double* output, int N);
+
 extern const double PI;
 
 #endif
\ No newline at end of file
@@ -14,6 +14,14 @@ void exportToCSV(const std::string& filename,
                  const std::vector<Complex>& dft_original,
                  const std::vector<Complex>& dft_filtered);
 
+// Экспорт вещественного сигнала и половины спектра (N/2+1 частот);
+// столбцы те же, частоты k > N/2 восстанавливаются как conj(X[N-k])
+void exportToCSV(const std::string& filename,
+                 const std::vector<double>& original_signal,
+                 const std::vector<double>& filtered_signal,
+                 const std::vector<Complex>& half_spectrum_original,
+                 const std::vector<Complex>& half_spectrum_filtered);
+
 void exportDiscontinuousSignal(const std::string& filename, 
                                const std::vector<Complex>& signal);
 
@@ -0,0 +1,36 @@
+#ifndef FFT_KERNELS_H
+#define FFT_KERNELS_H
+
+#include <complex>
+
+using Complex = std::complex<double>;
+
+// Набор векторных инструкций, доступный ядрам БПФ
+enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+// Определяется один раз по CPUID; без поддержки x86 - всегда Scalar
+SimdLevel detectSimdLevel();
+
+// Этап по основанию 4 над данными после бит-реверса: блоки длины 4M,
+// w - множители этапа W^m, W^2m, W^3m (W = exp(-2 pi i / 4M)),
+// лежащие тремя подряд идущими массивами длины M.
+// Комплексные числа хранятся чередованием re, im (как std::complex).
+using Radix4Kernel = void (*)(Complex* data, int N, int M, const Complex* w);
+
+void radix4StageScalar(Complex* data, int N, int M, const Complex* w);
+void radix4StageAVX2(Complex* data, int N, int M, const Complex* w);     // M >= 2
+void radix4StageAVX512(Complex* data, int N, int M, const Complex* w);   // M >= 4
+
+// Быстрейшее ядро, допустимое для данного уровня и размера этапа
+Radix4Kernel selectRadix4Kernel(SimdLevel level, int M);
+
+// Первый этап по основанию 2, если log2(N) нечётен
+void radix2FirstStage(Complex* data, int N);
+
+// Этап Стокхэма по основанию p (2, 3, 4, 5, 7) для длин, не являющихся
+// степенью двойки: x[k + s(q + m j)] -> y[k + s(t + p q)], q < m, k < s,
+// после малого ДПФ по j результат t умножается на w[q(p-1) + t-1] = W_{mp}^{qt}.
+// Порядок частот получается естественным, перестановка не нужна.
+void mixedRadixStage(const Complex* x, Complex* y, int s, int m, int p, const Complex* w);
+
+#endif
\ No newline at end of file
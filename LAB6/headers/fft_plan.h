@@ -0,0 +1,103 @@
+#ifndef FFT_PLAN_H
+#define FFT_PLAN_H
+
+#include <vector>
+#include <complex>
+#include <memory>
+#include "fft_kernels.h"
+
+using Complex = std::complex<double>;
+
+// Алгоритм, выбранный планом по длине N
+enum class FFTAlgorithm {
+    Radix4,       // N = 2^k: бит-реверс и этапы по основанию 4
+    MixedRadix,   // N = 2^a 3^b 5^c 7^d: этапы Стокхэма по основаниям 2, 3, 4, 5, 7
+    Bluestein     // прочие N: свёртка с чирпом через БПФ длины 2^k >= 2N-1
+};
+
+// План БПФ фиксированной длины N: поворотные множители и перестановка
+// бит-реверса считаются один раз, execute выполняет только бабочки
+// (этапы по основанию 4, ядро каждого этапа выбирается по level).
+// Для других длин план выбирает смешанные основания или Блюстейна,
+// так что любое N >= 1 считается за O(N log N).
+// Готовый план не изменяется, поэтому его можно делить между потоками.
+class FFTPlan {
+public:
+    explicit FFTPlan(int N, SimdLevel level = detectSimdLevel());
+
+    int size() const { return N; }
+    FFTAlgorithm algorithm() const { return method; }
+
+    // На горячем пути память не выделяется: работа идёт в буферах вызывающего.
+    // MixedRadix и Bluestein используют рабочий буфер потока, который
+    // выделяется один раз и дальше только переиспользуется.
+    // out-of-place версии допускают input == output.
+    void execute(Complex* data) const;
+    void execute(const Complex* input, Complex* output) const;
+    void executeInverse(Complex* data) const;
+    void executeInverse(const Complex* input, Complex* output) const;
+
+    void execute(std::vector<Complex>& data) const;
+
+    // План из общего потокобезопасного кэша, ключ - длина N
+    static std::shared_ptr<const FFTPlan> plan(int N);
+
+private:
+    void butterflies(Complex* data) const;
+    void executeMixedRadix(Complex* data) const;
+    void executeBluestein(Complex* data) const;
+
+    struct Radix4Stage {
+        int M;                   // четверть длины блока
+        size_t twiddle_offset;   // начало W^m, W^2m, W^3m в twiddles
+        Radix4Kernel kernel;
+    };
+
+    struct MixedRadixStage {
+        int p;                   // основание
+        int m;                   // длина подпреобразований после этапа
+        size_t twiddle_offset;   // W_{mp}^{qt} в twiddles
+    };
+
+    int N;
+    FFTAlgorithm method;
+    bool radix2_first;           // log2(N) нечётен
+    std::vector<int> bit_reversal;
+    std::vector<Complex> twiddles;
+    std::vector<Radix4Stage> stages;
+    std::vector<MixedRadixStage> mixed_stages;
+
+    // Блюстейн: chirp[n] = exp(i pi n^2 / N), chirp_spectrum - БПФ
+    // симметрично продолженного чирпа длины convolution->size()
+    std::vector<Complex> chirp;
+    std::vector<Complex> chirp_spectrum;
+    std::shared_ptr<const FFTPlan> convolution;
+};
+
+// План БПФ вещественного сигнала длины N через комплексное БПФ длины N/2:
+// z[k] = x[2k] + i x[2k+1], спектры чётных и нечётных отсчётов
+// разделяются по сопряжённой симметрии. Возвращаются только
+// неизбыточные частоты 0..N/2, остальные равны conj(X[N-k]).
+// Нечётные N считаются полным комплексным планом через буфер потока.
+class RealFFTPlan {
+public:
+    explicit RealFFTPlan(int N);
+
+    int size() const { return N; }
+    int spectrumSize() const { return N / 2 + 1; }
+
+    // input - N вещественных отсчётов, output - N/2+1 частот; без выделения памяти
+    void execute(const double* input, Complex* output) const;
+    // Обратное: N/2+1 частот -> N отсчётов, мнимые части X[0] и X[N/2] игнорируются
+    void executeInverse(const Complex* input, double* output) const;
+
+    static std::shared_ptr<const RealFFTPlan> plan(int N);
+
+private:
+    int N;
+    std::shared_ptr<const FFTPlan> half;    // N/2 для чётных N
+    std::shared_ptr<const FFTPlan> full;    // N для нечётных N
+    std::vector<Complex> twiddles;   // W^k = exp(-2 pi i k / N), k = 0..N/4
+};
+
+#endif
\ No newline at end of file
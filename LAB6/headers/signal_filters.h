@@ -9,4 +9,7 @@ using Complex = std::complex<double>;
 // Фильтры сигналов
 std::vector<Complex> filterHighFrequencies(const std::vector<Complex>& dft_result);
 
+// То же для половины спектра (N/2+1 частот из rfft) сигнала длины N
+std::vector<Complex> filterHighFrequencies(const std::vector<Complex>& half_spectrum, int N);
+
 #endif
\ No newline at end of file
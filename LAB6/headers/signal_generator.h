@@ -16,4 +16,8 @@ struct SignalParams {
 std::vector<Complex> generateSignal1(const SignalParams& params);
 std::vector<Complex> generateSignal2(const SignalParams& params);
 
+// Те же сигналы без мнимой части - вход для rfft
+std::vector<double> generateRealSignal1(const SignalParams& params);
+std::vector<double> generateRealSignal2(const SignalParams& params);
+
 #endif
\ No newline at end of file
@@ -10,16 +10,19 @@ using Complex = std::complex<double>;
 struct TimingResults{
     long long dft_time;
     long long fft_time;
+    long long rfft_time;
 };
 
 struct AnalysisResults{
     std::vector<Complex> dft_result;
     std::vector<Complex> fft_result;
+    std::vector<Complex> rfft_result;   // N/2+1 частот вещественной части сигнала
     TimingResults timing;
 };
 
-AnalysisResults analyzeSignal(const std::vector<Complex>& signal);
-void printResultsTable(const std::vector<Complex>& signal, 
+// DFT и FFT считаются по комплексной копии сигнала, RFFT - по самому сигналу
+AnalysisResults analyzeSignal(const std::vector<double>& signal);
+void printResultsTable(const std::vector<double>& signal, 
                        const std::vector<Complex>& dft_result);
 
 #endif
\ No newline at end of file
@@ -21,7 +21,7 @@ int main() {
     params.phi = PI / 6;
     
     printSectionHeader("SECTION 2: SIGNAL GENERATION");
-    vector<Complex> signal = generateSignal1(params);
+    vector<double> signal = generateRealSignal1(params);
     cout << "Signal generated. N = " << params.N << " points" << endl;
     cout << "Parameters: A = " << params.A 
          << ", B = " << params.B 
@@ -34,6 +34,7 @@ int main() {
     
     cout << "DFT execution time: " << analysis.timing.dft_time << " μs" << endl;
     cout << "FFT execution time: " << analysis.timing.fft_time << " μs" << endl;
+    cout << "RFFT execution time: " << analysis.timing.rfft_time << " μs" << endl;
     cout << "Speedup factor (DFT/FFT): " 
          << analysis.timing.dft_time / analysis.timing.fft_time << endl;
     
@@ -41,24 +42,25 @@ int main() {
     printResultsTable(signal, analysis.dft_result);
     
     printSectionHeader("SECTION 4: NOISE COMPONENT FILTERING");
-    vector<Complex> filtered_dft = filterHighFrequencies(analysis.dft_result);
+    // Сигнал вещественный: фильтруется половина спектра из rfft (частоты 0..N/2)
+    vector<Complex> filtered_spectrum = filterHighFrequencies(analysis.rfft_result, params.N);
     cout << "High-frequency components filtered." << endl;
     cout << "Original DFT size: " << analysis.dft_result.size() << " components" << endl;
-    cout << "Filtered DFT size: " << filtered_dft.size() << " components" << endl;
+    cout << "Filtered half-spectrum size: " << filtered_spectrum.size() << " components (m = 0..N/2)" << endl;
     
 
     printSectionHeader("SECTION 5: DATA EXPORT FOR VISUALIZATION");
-    vector<Complex> reconstructed = idft(filtered_dft);
+    vector<double> reconstructed = irfft(filtered_spectrum, params.N);
     
     exportToCSV("fourier_analysis_results.csv", signal, reconstructed,
-                analysis.dft_result, filtered_dft);
+                analysis.rfft_result, filtered_spectrum);
     
     cout << "Data exported to 'signal_analysis.csv'" << endl;
     cout << "Files created:" << endl;
     cout << "  - Original signal: " << params.N << " points" << endl;
     cout << "  - Reconstructed signal: " << reconstructed.size() << " points" << endl;
     cout << "  - DFT spectrum: " << analysis.dft_result.size() << " components" << endl;
-    cout << "  - Filtered spectrum: " << filtered_dft.size() << " components" << endl;
+    cout << "  - Filtered spectrum: " << reconstructed.size() << " components" << endl;
     
     printSectionHeader("SECTION 6: DISCONTINUOUS SIGNAL ANALYSIS");
     analyzeDiscontinuousSignal(params);
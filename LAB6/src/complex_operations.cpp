@@ -1,6 +1,8 @@
 #include "complex_operations.h"
+#include "fft_plan.h"
 #include <cmath>
 #include <algorithm>
+#include <stdexcept>
 
 using namespace std;
 
@@ -32,54 +34,57 @@ vector<Complex> idft(const vector<Complex>& input) {
 }
 
 vector<Complex> fft(const vector<Complex>& input) {
-    int N = input.size();
-
     vector<Complex> result = input;
-    for (int i = 1, j = 0; i < N; i++) {
-        int bit = N >> 1;
-        for (; j & bit; bit >>= 1)
-            j ^= bit;
-        j ^= bit;
-        if (i < j) swap(result[i], result[j]);
-    }
+    fft(result.data(), result.size());
+    return result;
+}
 
-    for (int len = 2; len <= N; len <<= 1) {
-        int M = len / 2;
+vector<Complex> ifft(const vector<Complex>& input) {
+    vector<Complex> output = input;
+    ifft(output.data(), output.size());
+    return output;
+}
 
-        vector<Complex> twiddles(M);
-        for (int m = 0; m < M; m++) {
-            double angle = -2 * PI * m / len;
-            twiddles[m] = exp(Complex(0, angle));
-        }
-        for (int i = 0; i < N; i += len) {
-            for (int m = 0; m < M; m++) {
-                Complex u = result[i + m];    
-                Complex v = result[i + m + M];    
-                Complex twiddle = twiddles[m];
+// Пустой сигнал - пустой спектр; план длины 0 не строится (FFTPlan требует N >= 1)
+void fft(Complex* data, int N) {
+    if (N == 0) return;
+    FFTPlan::plan(N)->execute(data);
+}
 
-                result[i + m] = u + twiddle * v;
-                result[i + m + M] = u - twiddle * v;
-            }
-        }
-    }
+void fft(const Complex* input, Complex* output, int N) {
+    if (N == 0) return;
+    FFTPlan::plan(N)->execute(input, output);
+}
 
-    return result;
+void ifft(Complex* data, int N) {
+    if (N == 0) return;
+    FFTPlan::plan(N)->executeInverse(data);
 }
 
-vector<Complex> ifft(const vector<Complex>& input) {
+void ifft(const Complex* input, Complex* output, int N) {
+    if (N == 0) return;
+    FFTPlan::plan(N)->executeInverse(input, output);
+}
+
+vector<Complex> rfft(const vector<double>& input) {
     int N = input.size();
+    vector<Complex> output(N / 2 + 1);
+    rfft(input.data(), output.data(), N);
+    return output;
+}
 
-    vector<Complex> conjugated_input(N);
-    for (int j = 0; j < N; j++) {
-        conjugated_input[j] = conj(input[j]);
-    }
+vector<double> irfft(const vector<Complex>& spectrum, int N) {
+    if (N < 0 || spectrum.size() != static_cast<size_t>(N / 2 + 1))
+        throw invalid_argument("irfft: spectrum size must be N/2+1");
+    vector<double> output(N);
+    irfft(spectrum.data(), output.data(), N);
+    return output;
+}
 
-    vector<Complex> temp = fft(conjugated_input);
-    
-    vector<Complex> output(N);
-    for (int j = 0; j < N; j++) {
-        output[j] = conj(temp[j]) / double(N);
-    }
+void rfft(const double* input, Complex* output, int N) {
+    RealFFTPlan::plan(N)->execute(input, output);
+}
 
-    return output;
+void irfft(const Complex* input, double* output, int N) {
+    RealFFTPlan::plan(N)->executeInverse(input, output);
 }
\ No newline at end of file
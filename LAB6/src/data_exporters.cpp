@@ -33,6 +33,37 @@ void exportToCSV(const string& filename,
     cout << "Data exported to: " << filename << endl;
 }
 
+void exportToCSV(const string& filename,
+                 const vector<double>& original_signal,
+                 const vector<double>& filtered_signal,
+                 const vector<Complex>& half_spectrum_original,
+                 const vector<Complex>& half_spectrum_filtered) {
+    ofstream file(filename);
+
+    file << "sample,original,filtered,"
+         << "spectrum_real,spectrum_imag,spectrum_mag,"
+         << "spectrum_filt_real,spectrum_filt_imag,spectrum_filt_mag" << endl;
+
+    int N = original_signal.size();
+    for (int i = 0; i < N; i++) {
+        bool mirrored = 2 * i > N;
+        Complex original = mirrored ? conj(half_spectrum_original[N - i]) : half_spectrum_original[i];
+        Complex filtered = mirrored ? conj(half_spectrum_filtered[N - i]) : half_spectrum_filtered[i];
+        file << i << ","
+             << original_signal[i] << ","
+             << filtered_signal[i] << ","
+             << original.real() << ","
+             << original.imag() << ","
+             << abs(original) << ","
+             << filtered.real() << ","
+             << filtered.imag() << ","
+             << abs(filtered) << endl;
+    }
+
+    file.close();
+    cout << "Data exported to: " << filename << endl;
+}
+
 void exportDiscontinuousSignal(const string& filename, 
                                const vector<Complex>& signal) {
     ofstream file(filename);
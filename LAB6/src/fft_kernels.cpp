@@ -0,0 +1,307 @@
+#include "fft_kernels.h"
+#include <stdexcept>
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FFT_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+SimdLevel detectSimdLevel() {
+#ifdef FFT_X86_KERNELS
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return SimdLevel::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return SimdLevel::AVX2;
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+// Комплексная арифметика записана вручную: умножение std::complex
+// проверяет NaN/inf и не векторизуется компилятором.
+void radix4StageScalar(Complex* data, int N, int M, const Complex* w) {
+    double* x = reinterpret_cast<double*>(data);
+    const double* tw = reinterpret_cast<const double*>(w);
+
+    for (int i = 0; i < N; i += 4 * M) {
+        double* x0 = x + 2 * i;
+        double* x1 = x0 + 2 * M;
+        double* x2 = x1 + 2 * M;
+        double* x3 = x2 + 2 * M;
+        for (int m = 0; m < M; m++) {
+            int k = 2 * m;
+            double w1r = tw[k], w1i = tw[k + 1];
+            double w2r = tw[2 * M + k], w2i = tw[2 * M + k + 1];
+            double w3r = tw[4 * M + k], w3i = tw[4 * M + k + 1];
+
+            double a0r = x0[k], a0i = x0[k + 1];
+            double a1r = x1[k] * w2r - x1[k + 1] * w2i;
+            double a1i = x1[k] * w2i + x1[k + 1] * w2r;
+            double a2r = x2[k] * w1r - x2[k + 1] * w1i;
+            double a2i = x2[k] * w1i + x2[k + 1] * w1r;
+            double a3r = x3[k] * w3r - x3[k + 1] * w3i;
+            double a3i = x3[k] * w3i + x3[k + 1] * w3r;
+
+            double s0r = a0r + a1r, s0i = a0i + a1i;
+            double d0r = a0r - a1r, d0i = a0i - a1i;
+            double s1r = a2r + a3r, s1i = a2i + a3i;
+            double d1r = a2r - a3r, d1i = a2i - a3i;
+
+            x0[k] = s0r + s1r;  x0[k + 1] = s0i + s1i;
+            x2[k] = s0r - s1r;  x2[k + 1] = s0i - s1i;
+            x1[k] = d0r + d1i;  x1[k + 1] = d0i - d1r;
+            x3[k] = d0r - d1i;  x3[k + 1] = d0i + d1r;
+        }
+    }
+}
+
+#ifdef FFT_X86_KERNELS
+
+// Два комплексных числа в регистре: (re0, im0, re1, im1)
+__attribute__((target("avx2,fma")))
+static inline __m256d complexMulAVX2(__m256d a, __m256d w) {
+    __m256d wr = _mm256_movedup_pd(w);
+    __m256d wi = _mm256_permute_pd(w, 0xF);
+    __m256d swapped = _mm256_permute_pd(a, 0x5);
+    return _mm256_fmaddsub_pd(a, wr, _mm256_mul_pd(swapped, wi));
+}
+
+__attribute__((target("avx2,fma")))
+void radix4StageAVX2(Complex* data, int N, int M, const Complex* w) {
+    double* x = reinterpret_cast<double*>(data);
+    const double* tw = reinterpret_cast<const double*>(w);
+    // Умножение на -i: (re, im) -> (im, -re)
+    const __m256d negate_im = _mm256_set_pd(-0.0, 0.0, -0.0, 0.0);
+
+    for (int i = 0; i < N; i += 4 * M) {
+        double* x0 = x + 2 * i;
+        double* x1 = x0 + 2 * M;
+        double* x2 = x1 + 2 * M;
+        double* x3 = x2 + 2 * M;
+        for (int k = 0; k < 2 * M; k += 4) {
+            __m256d w1 = _mm256_loadu_pd(tw + k);
+            __m256d w2 = _mm256_loadu_pd(tw + 2 * M + k);
+            __m256d w3 = _mm256_loadu_pd(tw + 4 * M + k);
+
+            __m256d a0 = _mm256_loadu_pd(x0 + k);
+            __m256d a1 = complexMulAVX2(_mm256_loadu_pd(x1 + k), w2);
+            __m256d a2 = complexMulAVX2(_mm256_loadu_pd(x2 + k), w1);
+            __m256d a3 = complexMulAVX2(_mm256_loadu_pd(x3 + k), w3);
+
+            __m256d s0 = _mm256_add_pd(a0, a1);
+            __m256d d0 = _mm256_sub_pd(a0, a1);
+            __m256d s1 = _mm256_add_pd(a2, a3);
+            __m256d d1 = _mm256_xor_pd(_mm256_permute_pd(_mm256_sub_pd(a2, a3), 0x5), negate_im);
+
+            _mm256_storeu_pd(x0 + k, _mm256_add_pd(s0, s1));
+            _mm256_storeu_pd(x2 + k, _mm256_sub_pd(s0, s1));
+            _mm256_storeu_pd(x1 + k, _mm256_add_pd(d0, d1));
+            _mm256_storeu_pd(x3 + k, _mm256_sub_pd(d0, d1));
+        }
+    }
+}
+
+// Заголовки GCC 12 дают ложное -Wmaybe-uninitialized на _mm512_undefined_pd
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// Четыре комплексных числа в регистре
+__attribute__((target("avx512f")))
+static inline __m512d complexMulAVX512(__m512d a, __m512d w) {
+    __m512d wr = _mm512_movedup_pd(w);
+    __m512d wi = _mm512_permute_pd(w, 0xFF);
+    __m512d swapped = _mm512_permute_pd(a, 0x55);
+    return _mm512_fmaddsub_pd(a, wr, _mm512_mul_pd(swapped, wi));
+}
+
+__attribute__((target("avx512f")))
+void radix4StageAVX512(Complex* data, int N, int M, const Complex* w) {
+    double* x = reinterpret_cast<double*>(data);
+    const double* tw = reinterpret_cast<const double*>(w);
+    const __m512i negate_im = _mm512_set_epi64(
+        (long long)0x8000000000000000ULL, 0, (long long)0x8000000000000000ULL, 0,
+        (long long)0x8000000000000000ULL, 0, (long long)0x8000000000000000ULL, 0);
+
+    for (int i = 0; i < N; i += 4 * M) {
+        double* x0 = x + 2 * i;
+        double* x1 = x0 + 2 * M;
+        double* x2 = x1 + 2 * M;
+        double* x3 = x2 + 2 * M;
+        for (int k = 0; k < 2 * M; k += 8) {
+            __m512d w1 = _mm512_loadu_pd(tw + k);
+            __m512d w2 = _mm512_loadu_pd(tw + 2 * M + k);
+            __m512d w3 = _mm512_loadu_pd(tw + 4 * M + k);
+
+            __m512d a0 = _mm512_loadu_pd(x0 + k);
+            __m512d a1 = complexMulAVX512(_mm512_loadu_pd(x1 + k), w2);
+            __m512d a2 = complexMulAVX512(_mm512_loadu_pd(x2 + k), w1);
+            __m512d a3 = complexMulAVX512(_mm512_loadu_pd(x3 + k), w3);
+
+            __m512d s0 = _mm512_add_pd(a0, a1);
+            __m512d d0 = _mm512_sub_pd(a0, a1);
+            __m512d s1 = _mm512_add_pd(a2, a3);
+            __m512d diff = _mm512_permute_pd(_mm512_sub_pd(a2, a3), 0x55);
+            __m512d d1 = _mm512_castsi512_pd(
+                _mm512_xor_si512(_mm512_castpd_si512(diff), negate_im));
+
+            _mm512_storeu_pd(x0 + k, _mm512_add_pd(s0, s1));
+            _mm512_storeu_pd(x2 + k, _mm512_sub_pd(s0, s1));
+            _mm512_storeu_pd(x1 + k, _mm512_add_pd(d0, d1));
+            _mm512_storeu_pd(x3 + k, _mm512_sub_pd(d0, d1));
+        }
+    }
+}
+
+#pragma GCC diagnostic pop
+
+#else
+
+void radix4StageAVX2(Complex*, int, int, const Complex*) {
+    throw runtime_error("radix4StageAVX2: not supported on this platform");
+}
+
+void radix4StageAVX512(Complex*, int, int, const Complex*) {
+    throw runtime_error("radix4StageAVX512: not supported on this platform");
+}
+
+#endif
+
+Radix4Kernel selectRadix4Kernel(SimdLevel level, int M) {
+    if (level == SimdLevel::AVX512 && M >= 4)
+        return radix4StageAVX512;
+    if ((level == SimdLevel::AVX512 || level == SimdLevel::AVX2) && M >= 2)
+        return radix4StageAVX2;
+    return radix4StageScalar;
+}
+
+void radix2FirstStage(Complex* data, int N) {
+    double* x = reinterpret_cast<double*>(data);
+    for (int k = 0; k < 2 * N; k += 4) {
+        double ur = x[k], ui = x[k + 1];
+        double vr = x[k + 2], vi = x[k + 3];
+        x[k] = ur + vr;      x[k + 1] = ui + vi;
+        x[k + 2] = ur - vr;  x[k + 3] = ui - vi;
+    }
+}
+
+static inline Complex complexMul(Complex a, Complex b) {
+    return Complex(a.real() * b.real() - a.imag() * b.imag(),
+                   a.real() * b.imag() + a.imag() * b.real());
+}
+
+// Умножение на -i
+static inline Complex rotateMinusI(Complex a) {
+    return Complex(a.imag(), -a.real());
+}
+
+void mixedRadixStage(const Complex* x, Complex* y, int s, int m, int p, const Complex* w) {
+    const double pi = 3.14159265358979323846;
+
+    switch (p) {
+    case 2:
+        for (int q = 0; q < m; q++) {
+            Complex w1 = w[q];
+            for (int k = 0; k < s; k++) {
+                Complex a0 = x[k + s * q], a1 = x[k + s * (q + m)];
+                y[k + s * (2 * q)] = a0 + a1;
+                y[k + s * (2 * q + 1)] = complexMul(a0 - a1, w1);
+            }
+        }
+        break;
+
+    case 3: {
+        const double sin60 = sqrt(3.0) / 2;
+        for (int q = 0; q < m; q++) {
+            Complex w1 = w[2 * q], w2 = w[2 * q + 1];
+            for (int k = 0; k < s; k++) {
+                Complex a0 = x[k + s * q], a1 = x[k + s * (q + m)], a2 = x[k + s * (q + 2 * m)];
+                Complex sum = a1 + a2;
+                Complex t = a0 - 0.5 * sum;
+                Complex u = rotateMinusI(sin60 * (a1 - a2));
+                Complex* out = y + k + s * (3 * q);
+                out[0] = a0 + sum;
+                out[s] = complexMul(t + u, w1);
+                out[2 * s] = complexMul(t - u, w2);
+            }
+        }
+        break;
+    }
+
+    case 4:
+        for (int q = 0; q < m; q++) {
+            Complex w1 = w[3 * q], w2 = w[3 * q + 1], w3 = w[3 * q + 2];
+            for (int k = 0; k < s; k++) {
+                Complex a0 = x[k + s * q], a1 = x[k + s * (q + m)];
+                Complex a2 = x[k + s * (q + 2 * m)], a3 = x[k + s * (q + 3 * m)];
+                Complex s0 = a0 + a2, d0 = a0 - a2;
+                Complex s1 = a1 + a3, d1 = rotateMinusI(a1 - a3);
+                Complex* out = y + k + s * (4 * q);
+                out[0] = s0 + s1;
+                out[s] = complexMul(d0 + d1, w1);
+                out[2 * s] = complexMul(s0 - s1, w2);
+                out[3 * s] = complexMul(d0 - d1, w3);
+            }
+        }
+        break;
+
+    case 5: {
+        const double c1 = cos(2 * pi / 5), c2 = cos(4 * pi / 5);
+        const double s1 = sin(2 * pi / 5), s2 = sin(4 * pi / 5);
+        for (int q = 0; q < m; q++) {
+            const Complex* wq = w + 4 * q;
+            for (int k = 0; k < s; k++) {
+                Complex a0 = x[k + s * q];
+                Complex a1 = x[k + s * (q + m)], a2 = x[k + s * (q + 2 * m)];
+                Complex a3 = x[k + s * (q + 3 * m)], a4 = x[k + s * (q + 4 * m)];
+                Complex b1 = a1 + a4, b2 = a2 + a3;
+                Complex e1 = a1 - a4, e2 = a2 - a3;
+                Complex t1 = a0 + c1 * b1 + c2 * b2;
+                Complex t2 = a0 + c2 * b1 + c1 * b2;
+                Complex u1 = rotateMinusI(s1 * e1 + s2 * e2);
+                Complex u2 = rotateMinusI(s2 * e1 - s1 * e2);
+                Complex* out = y + k + s * (5 * q);
+                out[0] = a0 + b1 + b2;
+                out[s] = complexMul(t1 + u1, wq[0]);
+                out[2 * s] = complexMul(t2 + u2, wq[1]);
+                out[3 * s] = complexMul(t2 - u2, wq[2]);
+                out[4 * s] = complexMul(t1 - u1, wq[3]);
+            }
+        }
+        break;
+    }
+
+    default: {
+        // Прямое малое ДПФ, используется для p = 7
+        if (p > 7)
+            throw invalid_argument("mixedRadixStage: radix must not exceed 7");
+        Complex roots[7];
+        for (int j = 0; j < p; j++)
+            roots[j] = Complex(cos(2 * pi * j / p), -sin(2 * pi * j / p));
+
+        Complex a[7];
+        for (int q = 0; q < m; q++) {
+            const Complex* wq = w + (p - 1) * q;
+            for (int k = 0; k < s; k++) {
+                for (int j = 0; j < p; j++)
+                    a[j] = x[k + s * (q + m * j)];
+                Complex* out = y + k + s * (p * q);
+                for (int t = 0; t < p; t++) {
+                    Complex sum = a[0];
+                    for (int j = 1; j < p; j++)
+                        sum += complexMul(a[j], roots[(j * t) % p]);
+                    out[t * s] = (t == 0) ? sum : complexMul(sum, wq[t - 1]);
+                }
+            }
+        }
+        break;
+    }
+    }
+}
\ No newline at end of file
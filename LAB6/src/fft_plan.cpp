@@ -0,0 +1,332 @@
+#include "fft_plan.h"
+#include "complex_operations.h"
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <algorithm>
+
+using namespace std;
+
+// Рабочие буферы потока для длин, не являющихся степенью двойки:
+// растут до наибольшей встреченной длины и дальше переиспользуются.
+// Слот 0 занят FFTPlan, слот 1 - RealFFTPlan, который вызывает FFTPlan.
+static Complex* threadScratch(int slot, size_t size) {
+    thread_local vector<Complex> buffers[2];
+    if (buffers[slot].size() < size)
+        buffers[slot].resize(size);
+    return buffers[slot].data();
+}
+
+FFTPlan::FFTPlan(int N, SimdLevel level) : N(N), radix2_first(false) {
+    if (N < 1)
+        throw invalid_argument("FFTPlan: N must be positive");
+
+    if ((N & (N - 1)) == 0) {
+        method = FFTAlgorithm::Radix4;
+
+        bit_reversal.resize(N);
+        bit_reversal[0] = 0;
+        for (int i = 1, j = 0; i < N; i++) {
+            int bit = N >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+            bit_reversal[i] = j;
+        }
+
+        int log2N = 0;
+        while ((1 << log2N) < N)
+            log2N++;
+
+        // Нечётный log2(N) добирается одним этапом по основанию 2 без множителей,
+        // остальные этапы - по основанию 4 с блоками длины 4M
+        radix2_first = (log2N % 2 == 1);
+        for (int M = radix2_first ? 2 : 1; 4 * M <= N; M *= 4) {
+            Radix4Stage stage;
+            stage.M = M;
+            stage.twiddle_offset = twiddles.size();
+            stage.kernel = selectRadix4Kernel(level, M);
+            for (int power = 1; power <= 3; power++) {
+                for (int m = 0; m < M; m++) {
+                    double angle = -2 * PI * power * m / (4 * M);
+                    twiddles.push_back(Complex(cos(angle), sin(angle)));
+                }
+            }
+            stages.push_back(stage);
+        }
+        return;
+    }
+
+    vector<int> factors;
+    int rest = N;
+    while (rest % 4 == 0) {
+        factors.push_back(4);
+        rest /= 4;
+    }
+    for (int p : {2, 3, 5, 7}) {
+        while (rest % p == 0) {
+            factors.push_back(p);
+            rest /= p;
+        }
+    }
+
+    if (rest == 1) {
+        method = FFTAlgorithm::MixedRadix;
+
+        int n = N;
+        for (int p : factors) {
+            MixedRadixStage stage;
+            stage.p = p;
+            stage.m = n / p;
+            stage.twiddle_offset = twiddles.size();
+            for (int q = 0; q < stage.m; q++) {
+                for (int t = 1; t < p; t++) {
+                    double angle = -2 * PI * ((long long)q * t % n) / n;
+                    twiddles.push_back(Complex(cos(angle), sin(angle)));
+                }
+            }
+            mixed_stages.push_back(stage);
+            n = stage.m;
+        }
+        return;
+    }
+
+    // X[k] = conj(b[k]) * sum a[n] b[k-n], a[n] = x[n] conj(b[n]), b[n] = exp(i pi n^2 / N):
+    // свёртка длины N считается циклической свёрткой длины L = 2^k >= 2N-1
+    method = FFTAlgorithm::Bluestein;
+
+    int L = 1;
+    while (L < 2 * N - 1)
+        L <<= 1;
+    convolution = make_shared<const FFTPlan>(L, level);
+
+    chirp.resize(N);
+    for (int n = 0; n < N; n++) {
+        // n^2 mod 2N сохраняет точность угла при больших n
+        double angle = PI * ((long long)n * n % (2LL * N)) / N;
+        chirp[n] = Complex(cos(angle), sin(angle));
+    }
+
+    chirp_spectrum.assign(L, Complex(0, 0));
+    chirp_spectrum[0] = chirp[0];
+    for (int n = 1; n < N; n++) {
+        chirp_spectrum[n] = chirp[n];
+        chirp_spectrum[L - n] = chirp[n];
+    }
+    convolution->execute(chirp_spectrum.data());
+}
+
+void FFTPlan::execute(vector<Complex>& data) const {
+    if ((int)data.size() != N)
+        throw invalid_argument("FFTPlan: data size does not match plan size");
+    execute(data.data());
+}
+
+void FFTPlan::execute(Complex* data) const {
+    if (method == FFTAlgorithm::MixedRadix) {
+        executeMixedRadix(data);
+        return;
+    }
+    if (method == FFTAlgorithm::Bluestein) {
+        executeBluestein(data);
+        return;
+    }
+
+    for (int i = 1; i < N; i++) {
+        int j = bit_reversal[i];
+        if (i < j) swap(data[i], data[j]);
+    }
+    butterflies(data);
+}
+
+void FFTPlan::execute(const Complex* input, Complex* output) const {
+    if (input != output && method != FFTAlgorithm::Radix4)
+        copy(input, input + N, output);
+    if (input == output || method != FFTAlgorithm::Radix4) {
+        execute(output);
+        return;
+    }
+    // Перестановка совмещена с копированием в выходной буфер
+    for (int i = 0; i < N; i++)
+        output[i] = input[bit_reversal[i]];
+    butterflies(output);
+}
+
+// Обратное преобразование через сопряжение на месте:
+// ifft(x) = conj(fft(conj(x))) / N
+void FFTPlan::executeInverse(Complex* data) const {
+    executeInverse(data, data);
+}
+
+void FFTPlan::executeInverse(const Complex* input, Complex* output) const {
+    if (input != output && method == FFTAlgorithm::Radix4) {
+        for (int i = 0; i < N; i++)
+            output[i] = conj(input[bit_reversal[i]]);
+        butterflies(output);
+    } else {
+        for (int i = 0; i < N; i++)
+            output[i] = conj(input[i]);
+        execute(output);
+    }
+    double scale = 1.0 / N;
+    for (int i = 0; i < N; i++)
+        output[i] = conj(output[i]) * scale;
+}
+
+void FFTPlan::butterflies(Complex* data) const {
+    if (radix2_first)
+        radix2FirstStage(data, N);
+    for (const Radix4Stage& stage : stages)
+        stage.kernel(data, N, stage.M, twiddles.data() + stage.twiddle_offset);
+}
+
+// Этапы Стокхэма поочерёдно пишут то в рабочий буфер, то обратно в data
+void FFTPlan::executeMixedRadix(Complex* data) const {
+    Complex* work = threadScratch(0, N);
+    Complex* from = data;
+    Complex* to = work;
+    int s = 1;
+    for (const MixedRadixStage& stage : mixed_stages) {
+        mixedRadixStage(from, to, s, stage.m, stage.p, twiddles.data() + stage.twiddle_offset);
+        s *= stage.p;
+        swap(from, to);
+    }
+    if (from != data)
+        copy(from, from + N, data);
+}
+
+void FFTPlan::executeBluestein(Complex* data) const {
+    int L = convolution->size();
+    Complex* a = threadScratch(0, L);
+
+    for (int n = 0; n < N; n++)
+        a[n] = data[n] * conj(chirp[n]);
+    fill(a + N, a + L, Complex(0, 0));
+
+    convolution->execute(a);
+    for (int j = 0; j < L; j++)
+        a[j] *= chirp_spectrum[j];
+    convolution->executeInverse(a);
+
+    for (int k = 0; k < N; k++)
+        data[k] = a[k] * conj(chirp[k]);
+}
+
+// Построение плана (для Блюстейна - с вложенным планом) идёт вне блокировки;
+// если два потока построили план одновременно, в кэше остаётся первый
+shared_ptr<const FFTPlan> FFTPlan::plan(int N) {
+    static mutex cache_mutex;
+    static map<int, shared_ptr<const FFTPlan>> cache;
+
+    {
+        lock_guard<mutex> lock(cache_mutex);
+        auto it = cache.find(N);
+        if (it != cache.end())
+            return it->second;
+    }
+
+    auto created = make_shared<const FFTPlan>(N);
+    lock_guard<mutex> lock(cache_mutex);
+    return cache.emplace(N, created).first->second;
+}
+
+RealFFTPlan::RealFFTPlan(int N) : N(N) {
+    if (N < 1)
+        throw invalid_argument("RealFFTPlan: N must be positive");
+    if (N % 2 == 1) {
+        full = FFTPlan::plan(N);
+        return;
+    }
+
+    half = FFTPlan::plan(N / 2);
+    twiddles.resize(N / 4 + 1);
+    for (int k = 0; k <= N / 4; k++) {
+        double angle = -2 * PI * k / N;
+        twiddles[k] = Complex(cos(angle), sin(angle));
+    }
+}
+
+void RealFFTPlan::execute(const double* input, Complex* output) const {
+    if (full) {
+        Complex* buffer = threadScratch(1, N);
+        for (int n = 0; n < N; n++)
+            buffer[n] = input[n];
+        full->execute(buffer);
+        copy(buffer, buffer + N / 2 + 1, output);
+        return;
+    }
+
+    // Упаковка пар отсчётов в первые M ячеек выходного буфера
+    int M = N / 2;
+    for (int k = 0; k < M; k++)
+        output[k] = Complex(input[2 * k], input[2 * k + 1]);
+    half->execute(output);
+
+    // X[k] = E[k] + W^k O[k], X[M-k] = conj(E[k] - W^k O[k]),
+    // E[k] = (Z[k] + conj(Z[M-k])) / 2, O[k] = -i (Z[k] - conj(Z[M-k])) / 2
+    double z0r = output[0].real(), z0i = output[0].imag();
+    output[0] = Complex(z0r + z0i, 0);
+    output[M] = Complex(z0r - z0i, 0);
+    for (int k = 1; k <= M / 2; k++) {
+        Complex a = output[k];
+        Complex b = conj(output[M - k]);
+        Complex E = 0.5 * (a + b);
+        Complex D = 0.5 * (a - b);
+        Complex O(D.imag(), -D.real());
+        Complex WO = twiddles[k] * O;
+
+        output[k] = E + WO;
+        if (k != M - k)
+            output[M - k] = conj(E - WO);
+    }
+}
+
+void RealFFTPlan::executeInverse(const Complex* input, double* output) const {
+    if (full) {
+        // Нечётное N: полный спектр восстанавливается по сопряжённой симметрии
+        Complex* buffer = threadScratch(1, N);
+        buffer[0] = input[0].real();
+        for (int k = 1; k <= N / 2; k++) {
+            buffer[k] = input[k];
+            buffer[N - k] = conj(input[k]);
+        }
+        full->executeInverse(buffer);
+        for (int n = 0; n < N; n++)
+            output[n] = buffer[n].real();
+        return;
+    }
+
+    // Сборка Z[k] = E[k] + i O[k] прямо в выходном буфере (M комплексных ячеек)
+    int M = N / 2;
+    Complex* z = reinterpret_cast<Complex*>(output);
+
+    double x0 = input[0].real(), xM = input[M].real();
+    z[0] = Complex(0.5 * (x0 + xM), 0.5 * (x0 - xM));
+    for (int k = 1; k <= M / 2; k++) {
+        Complex a = input[k];
+        Complex b = conj(input[M - k]);
+        Complex E = 0.5 * (a + b);
+        Complex O = 0.5 * (a - b) * conj(twiddles[k]);
+        Complex iO(-O.imag(), O.real());
+
+        z[k] = E + iO;
+        if (k != M - k)
+            z[M - k] = conj(E) + Complex(O.imag(), O.real());
+    }
+    half->executeInverse(z);
+}
+
+shared_ptr<const RealFFTPlan> RealFFTPlan::plan(int N) {
+    static mutex cache_mutex;
+    static map<int, shared_ptr<const RealFFTPlan>> cache;
+
+    lock_guard<mutex> lock(cache_mutex);
+    auto it = cache.find(N);
+    if (it != cache.end())
+        return it->second;
+
+    auto created = make_shared<const RealFFTPlan>(N);
+    cache.emplace(N, created);
+    return created;
+}
\ No newline at end of file
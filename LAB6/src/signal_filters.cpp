@@ -21,6 +21,28 @@ vector<Complex> filterHighFrequencies(const vector<Complex>& dft_result) {
         filtered[k] = 0;
     }
 
+    cout << "Removed component with non-zero amplitude: " << removed_count << endl;
+    return filtered;
+}
+
+vector<Complex> filterHighFrequencies(const vector<Complex>& half_spectrum, int N) {
+    vector<Complex> filtered = half_spectrum;
+
+    int keep_count = N / 10;
+
+    cout << "Simple filtering: " << endl;
+    cout << "We save frequencies: m = 0..." << keep_count << " and " << N - keep_count << "...N-1" << endl;
+
+    // Частоты k и N-k сопряжены, поэтому каждая удалённая частота
+    // внутри половины спектра считается за две, кроме k = N/2
+    int removed_count = 0;
+    for (int k = keep_count + 1; k < (int)filtered.size(); k++) {
+        if (abs(filtered[k]) > 1e-6) {
+            removed_count += (2 * k == N) ? 1 : 2;
+        }
+        filtered[k] = 0;
+    }
+
     cout << "Removed component with non-zero amplitude: " << removed_count << endl;
     return filtered;
 }
\ No newline at end of file
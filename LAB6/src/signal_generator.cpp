@@ -4,18 +4,17 @@
 
 using namespace std;
 
-vector<Complex> generateSignal1(const SignalParams& params) {
-    vector<Complex> signal(params.N);
+vector<double> generateRealSignal1(const SignalParams& params) {
+    vector<double> signal(params.N);
     for (int j = 0; j < params.N; j++) {
-        double value = params.A * cos(2 * PI * params.omega1 * j / params.N + params.phi) +
+        signal[j] = params.A * cos(2 * PI * params.omega1 * j / params.N + params.phi) +
             params.B * cos(2 * PI * params.omega2 * j / params.N);
-        signal[j] = value;
     }
     return signal;
 }
 
-vector<Complex> generateSignal2(const SignalParams& params) {
-    vector<Complex> signal(params.N, 0);
+vector<double> generateRealSignal2(const SignalParams& params) {
+    vector<double> signal(params.N, 0);
     for (int j = params.N / 4; j <= params.N / 2; j++) {
         signal[j] = params.A + params.B * cos(2 * PI * params.omega2 * j / params.N);
     }
@@ -23,4 +22,14 @@ vector<Complex> generateSignal2(const SignalParams& params) {
         signal[j] = params.A + params.B * cos(2 * PI * params.omega2 * j / params.N);
     }
     return signal;
+}
+
+vector<Complex> generateSignal1(const SignalParams& params) {
+    vector<double> real_signal = generateRealSignal1(params);
+    return vector<Complex>(real_signal.begin(), real_signal.end());
+}
+
+vector<Complex> generateSignal2(const SignalParams& params) {
+    vector<double> real_signal = generateRealSignal2(params);
+    return vector<Complex>(real_signal.begin(), real_signal.end());
 }
\ No newline at end of file
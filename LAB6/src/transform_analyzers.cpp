@@ -7,24 +7,30 @@
 using namespace std;
 using namespace std::chrono;
 
-AnalysisResults analyzeSignal(const vector<Complex>& signal) {
+AnalysisResults analyzeSignal(const vector<double>& signal) {
     AnalysisResults results;
+    vector<Complex> complex_signal(signal.begin(), signal.end());
 
     auto start_dft = high_resolution_clock::now();
-    results.dft_result = dft(signal);
+    results.dft_result = dft(complex_signal);
     auto end_dft = high_resolution_clock::now();
 
     auto start_fft = high_resolution_clock::now();
-    results.fft_result = fft(signal);
+    results.fft_result = fft(complex_signal);
     auto end_fft = high_resolution_clock::now();
 
+    auto start_rfft = high_resolution_clock::now();
+    results.rfft_result = rfft(signal);
+    auto end_rfft = high_resolution_clock::now();
+
     results.timing.dft_time = duration_cast<microseconds>(end_dft - start_dft).count();
     results.timing.fft_time = duration_cast<microseconds>(end_fft - start_fft).count();
+    results.timing.rfft_time = duration_cast<microseconds>(end_rfft - start_rfft).count();
 
     return results;
 }
 
-void printResultsTable(const vector<Complex>& signal, const vector<Complex>& dft_result) {
+void printResultsTable(const vector<double>& signal, const vector<Complex>& dft_result) {
     cout << fixed << setprecision(6);
     cout << setw(4) << "m" << setw(12) << "Re z" << setw(15) << "Re z_hat"
         << setw(15) << "Im z_hat" << setw(15) << "Amplitude" << setw(12) << "Phase" << endl;
@@ -44,7 +50,7 @@ void printResultsTable(const vector<Complex>& signal, const vector<Complex>& dft
 
         // ИЗМЕНЕНИЕ: используем ИЛИ вместо И
         if (significant_amplitude || significant_phase) { 
-            cout << setw(4) << m << setw(12) << signal[m].real()
+            cout << setw(4) << m << setw(12) << signal[m]
                 << setw(15) << dft_result[m].real()
                 << setw(15) << dft_result[m].imag()
                 << setw(15) << amplitude